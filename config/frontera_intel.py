@@ -14,6 +14,7 @@ f90  = 'ifort'
 
 flags_prec_single = ''
 flags_prec_double = '-real-size 64 -double-size 64'
+flags_fc_threads  = '-recursive'
 
 
 libpath_fortran = ''
@@ -14,6 +14,7 @@ f90  = 'ifort'
 
 flags_prec_single = '-real-size 32'
 flags_prec_double = '-real-size 64'
+flags_fc_threads  = '-recursive'
 
 libpath_fortran = ''
 libs_fortran    = ['irc', 'imf','ifcore','ifport','stdc++','intlc','svml']
@@ -19,6 +19,7 @@ f90 = 'ifort'
 
 flags_prec_single = ''
 flags_prec_double = '-r8'
+flags_fc_threads  = '-recursive'
 
 libpath_fortran = '.'
 libs_fortran    = ['ifcore', 'ifport']
@@ -0,0 +1,76 @@
+#!/bin/python
+
+# Benchmark of the adapt phase, which evaluates the refinement criteria
+# (Adapt:list) on every leaf Block each cycle.
+# - This script expects to be called from the root level of the repository
+#   OR at the same level where its defined
+# - Arguments are enzo-e executables to compare, e.g. builds before and
+#   after a change; the default is bin/enzo-e.  Set the LAUNCHER
+#   environment variable to a prefix for launching enzo-e, e.g.
+#       LAUNCHER="charmrun ++local +p4" python input/Adapt/run_adapt_benchmark.py
+#
+# For each executable the script runs input/Adapt/adapt_benchmark, and
+# reports total wall-clock time, the time in the "adapt_apply"
+# performance region (evaluating refinement criteria, summed over
+# processes), and the final number of leaf Blocks, which must be the
+# same for all executables since the criteria are unchanged.
+
+import os
+import re
+import shlex
+import shutil
+import subprocess
+import sys
+import time
+
+input_file = 'input/Adapt/adapt_benchmark/adapt_benchmark.in'
+output_dir = 'adapt_benchmark'
+
+def last_value(lines, pattern):
+    """Returns the integer at the end of the last line matching pattern"""
+    value = None
+    for line in lines:
+        m = re.search(pattern + r'\s+(\d+)\s*$', line)
+        if m:
+            value = int(m.group(1))
+    return value
+
+def run(launcher, executable):
+    start = time.time()
+    output = subprocess.check_output(launcher + [executable, input_file],
+                                     universal_newlines = True)
+    elapsed = time.time() - start
+    lines = output.splitlines()
+    adapt_usec = last_value(lines, r'Performance adapt_apply time-usec')
+    num_leaf = last_value(lines, r'num-leaf-blocks')
+    if os.path.isdir(output_dir):
+        shutil.rmtree(output_dir)
+    return elapsed, adapt_usec, num_leaf
+
+if __name__ == '__main__':
+
+    # this script can either be called from the base repository or from
+    # the subdirectory: input/Adapt
+    if os.getcwd()[-11:] == 'input/Adapt':
+        os.chdir('../../')
+
+    executables = sys.argv[1:] or ['bin/enzo-e']
+    for executable in executables:
+        if not os.path.isfile(executable):
+            raise RuntimeError("Can't locate the executable: " + executable)
+
+    launcher = shlex.split(os.environ.get('LAUNCHER', ''))
+
+    results = [run(launcher, executable) for executable in executables]
+
+    print("{:>10} {:>14} {:>10}  {}".format
+          ("time", "adapt_apply", "leaf", "executable"))
+    for executable, (elapsed, adapt_usec, num_leaf) in zip(executables,
+                                                           results):
+        print("{:8.3f} s {:11.3f} s {:10}  {}".format
+              (elapsed, 1e-6*(adapt_usec or 0), num_leaf, executable))
+
+    leaf_counts = set(num_leaf for (_, _, num_leaf) in results)
+    passed = len(leaf_counts) == 1 and None not in leaf_counts
+    print("PASSED" if passed else "FAILED")
+    sys.exit(0 if passed else 3)
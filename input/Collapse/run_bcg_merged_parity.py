@@ -0,0 +1,100 @@
+#!/bin/python
+
+# Compares the BiCgStab solver that merges the DOT(R,R) and DOT(R,R0)
+# reduction into the preceding reduction (Solver:<name>:merge_reductions)
+# against the default BiCgStab solver on the Collapse inputs.
+# - This script expects to be called from the root level of the repository
+#   OR at the same level where its defined
+# - Any arguments are used as a prefix for launching enzo-e, e.g.
+#       python input/Collapse/run_bcg_merged_parity.py charmrun +p4
+#
+# For each pair of runs, the script reports the wall-clock time of each run
+# and compares the number of iterations taken by each linear solve. The test
+# passes if every solve of the merged variant converges within
+# ITER_TOLERANCE iterations of the corresponding solve of the default solver.
+
+import os
+import os.path
+import re
+import shutil
+import subprocess
+import sys
+import time
+
+ITER_TOLERANCE = 2
+
+inputs = ['test_collapse-bcg2', 'test_collapse-bcg3', 'test_collapse-gas-bcg2']
+
+_iter_re = re.compile(r'Solver (\S+)\s+(?:final\s+)?iter (\d+)')
+
+def solve_iterations(output, solver = 'bcg'):
+    """
+    Returns the number of iterations taken by each solve in the output, which
+    is the last iteration reported before the iteration counter restarts.
+    """
+    counts = []
+    for line in output.splitlines():
+        match = _iter_re.search(line)
+        if match is None or match.group(1) != solver:
+            continue
+        it = int(match.group(2))
+        if it == 0 or len(counts) == 0:
+            counts.append(it)
+        else:
+            counts[-1] = it
+    return counts
+
+def run(launcher, executable, input_name):
+    command = launcher + [executable, 'input/{}.in'.format(input_name)]
+    start = time.time()
+    output = subprocess.check_output(command, stderr = subprocess.STDOUT)
+    elapsed = time.time() - start
+    return output.decode('utf-8', 'replace'), elapsed
+
+def compare(launcher, executable, input_name):
+    out_ref, time_ref = run(launcher, executable, input_name)
+    out_merged, time_merged = run(launcher, executable, input_name + '-merged')
+
+    iter_ref = solve_iterations(out_ref)
+    iter_merged = solve_iterations(out_merged)
+
+    print("{}:".format(input_name))
+    print("  time  default {:8.3f} s  merged {:8.3f} s  ratio {:6.3f}"
+          .format(time_ref, time_merged, time_merged/time_ref))
+    print("  iters default {:8d}    merged {:8d}    solves {:d}/{:d}"
+          .format(sum(iter_ref), sum(iter_merged),
+                  len(iter_ref), len(iter_merged)))
+
+    passed = (len(iter_ref) == len(iter_merged) and len(iter_ref) > 0)
+    if passed:
+        max_diff = max(abs(a - b) for a, b in zip(iter_ref, iter_merged))
+        passed = max_diff <= ITER_TOLERANCE
+        print("  max difference in iterations per solve {:d}".format(max_diff))
+    print("  {}".format("PASSED" if passed else "FAILED"))
+    return passed
+
+def cleanup():
+    for dir_name in os.listdir('.'):
+        if dir_name.startswith('Dir_Collapse-') and os.path.isdir(dir_name):
+            shutil.rmtree(dir_name)
+
+if __name__ == '__main__':
+
+    executable = 'bin/enzo-e'
+
+    # this script can either be called from the base repository or from
+    # the subdirectory: input/Collapse
+    if os.getcwd()[-14:] == 'input/Collapse':
+        os.chdir('../../')
+    if not os.path.isfile(executable):
+        raise RuntimeError("Can't locate the executable: " + executable)
+
+    launcher = sys.argv[1:]
+
+    results = [compare(launcher, executable, name) for name in inputs]
+    cleanup()
+
+    if all(results):
+        sys.exit(0)
+    else:
+        sys.exit(3)
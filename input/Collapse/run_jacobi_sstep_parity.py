@@ -0,0 +1,121 @@
+#!/bin/python
+
+# Compares Jacobi smoothers that perform several sweeps per ghost zone
+# refresh (Solver:<name>:sweeps_per_refresh) against the default of one
+# sweep per refresh, using the Collapse inputs with the "dd" and "hg"
+# gravity solvers.
+# - This script expects to be called from the root level of the repository
+#   OR at the same level where its defined
+# - Any arguments are used as a prefix for launching enzo-e, e.g.
+#       python input/Collapse/run_jacobi_sstep_parity.py charmrun +p4
+#
+# For each pair of runs, the script reports the wall-clock time and the
+# total number of refresh messages of each run, and compares the number of
+# iterations taken by each solve of the monitored outer solvers. The test
+# passes if every solve converges within ITER_TOLERANCE iterations of the
+# corresponding solve with the default smoother, and if the number of
+# refresh messages is reduced.
+
+import os
+import os.path
+import re
+import shutil
+import subprocess
+import sys
+import time
+
+ITER_TOLERANCE = 1
+
+# input name and the outer solvers whose iterations are compared
+inputs = [('test_collapse-dd2', ['dd_root', 'dd_domain']),
+          ('test_collapse-dd3', ['dd_root', 'dd_domain']),
+          ('test_collapse-hg2', ['hg'])]
+
+_iter_re = re.compile(r'Solver (\S+)\s+(?:final\s+)?iter (\d+)')
+_refresh_re = re.compile(r'counter num-msg-refresh (\d+)')
+
+def solve_iterations(output, solver):
+    """
+    Returns the number of iterations taken by each solve in the output, which
+    is the last iteration reported before the iteration counter restarts.
+    """
+    counts = []
+    for line in output.splitlines():
+        match = _iter_re.search(line)
+        if match is None or match.group(1) != solver:
+            continue
+        it = int(match.group(2))
+        if it == 0 or len(counts) == 0:
+            counts.append(it)
+        else:
+            counts[-1] = it
+    return counts
+
+def num_refresh(output):
+    """Returns the total number of refresh messages over all cycles"""
+    return sum(int(match.group(1)) for match in _refresh_re.finditer(output))
+
+def run(launcher, executable, input_name):
+    command = launcher + [executable, 'input/{}.in'.format(input_name)]
+    start = time.time()
+    output = subprocess.check_output(command, stderr = subprocess.STDOUT)
+    elapsed = time.time() - start
+    return output.decode('utf-8', 'replace'), elapsed
+
+def compare(launcher, executable, input_name, solvers):
+    out_ref, time_ref = run(launcher, executable, input_name)
+    out_sstep, time_sstep = run(launcher, executable, input_name + '-sstep')
+
+    refresh_ref = num_refresh(out_ref)
+    refresh_sstep = num_refresh(out_sstep)
+
+    print("{}:".format(input_name))
+    print("  time    default {:8.3f} s  s-step {:8.3f} s  ratio {:6.3f}"
+          .format(time_ref, time_sstep, time_sstep/time_ref))
+    print("  refresh default {:8d}    s-step {:8d}    ratio {:6.3f}"
+          .format(refresh_ref, refresh_sstep,
+                  refresh_sstep/max(refresh_ref,1)))
+
+    passed = refresh_sstep < refresh_ref
+    for solver in solvers:
+        iter_ref = solve_iterations(out_ref, solver)
+        iter_sstep = solve_iterations(out_sstep, solver)
+        print("  {:8s} iters default {:6d}  s-step {:6d}  solves {:d}/{:d}"
+              .format(solver, sum(iter_ref), sum(iter_sstep),
+                      len(iter_ref), len(iter_sstep)))
+        if len(iter_ref) != len(iter_sstep) or len(iter_ref) == 0:
+            passed = False
+            continue
+        max_diff = max(abs(a - b) for a, b in zip(iter_ref, iter_sstep))
+        print("  {:8s} max difference in iterations per solve {:d}"
+              .format(solver, max_diff))
+        passed = passed and max_diff <= ITER_TOLERANCE
+    print("  {}".format("PASSED" if passed else "FAILED"))
+    return passed
+
+def cleanup():
+    for dir_name in os.listdir('.'):
+        if dir_name.startswith('Dir_Collapse-') and os.path.isdir(dir_name):
+            shutil.rmtree(dir_name)
+
+if __name__ == '__main__':
+
+    executable = 'bin/enzo-e'
+
+    # this script can either be called from the base repository or from
+    # the subdirectory: input/Collapse
+    if os.getcwd()[-14:] == 'input/Collapse':
+        os.chdir('../../')
+    if not os.path.isfile(executable):
+        raise RuntimeError("Can't locate the executable: " + executable)
+
+    launcher = sys.argv[1:]
+
+    results = [compare(launcher, executable, name, solvers)
+               for name, solvers in inputs]
+    cleanup()
+
+    if all(results):
+        sys.exit(0)
+    else:
+        sys.exit(3)
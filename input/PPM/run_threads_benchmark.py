@@ -0,0 +1,95 @@
+#!/bin/python
+
+# Strong-scaling benchmark of PPM with the slices of each directional
+# sweep of a Block divided across threads (Method:ppm:threads).
+# - This script expects to be called from the root level of the repository
+#   OR at the same level where its defined
+# - Any arguments are used as a prefix for launching enzo-e, e.g.
+#       python input/PPM/run_threads_benchmark.py charmrun ++local
+#
+# Each run evolves the same 128^3 block with N = 1, 2, 4, 8 threads and
+# N processing elements (+pN), so that speedup requires an SMP build with
+# use_ckloop = 1. The script reports the wall-clock time and speedup of
+# each run, and checks that the final snapshots are identical to the
+# single-thread run (slices are independent, so threading does not change
+# the results).
+
+import os
+import os.path
+import shutil
+import subprocess
+import sys
+import time
+
+import h5py
+import numpy as np
+
+thread_counts = [1, 2, 4, 8]
+
+def input_name(threads):
+    return 'threads_benchmark-{}'.format(threads)
+
+def run(launcher, executable, threads):
+    command = launcher + [executable, '+p{}'.format(threads),
+                          'input/PPM/threads_benchmark/{}.in'
+                          .format(input_name(threads))]
+    start = time.time()
+    subprocess.check_call(command, stdout = subprocess.DEVNULL)
+    return time.time() - start
+
+def datasets(file_name):
+    """Returns a dict mapping each dataset path in the file to its values"""
+    values = {}
+    with h5py.File(file_name, 'r') as f:
+        def visit(name, obj):
+            if isinstance(obj, h5py.Dataset):
+                values[name] = obj[()]
+        f.visititems(visit)
+    return values
+
+def identical(threads):
+    """Whether the output of a run matches the single-thread run exactly"""
+    file_ref = os.path.join(input_name(1), 'data-000.h5')
+    file_run = os.path.join(input_name(threads), 'data-000.h5')
+    ref = datasets(file_ref)
+    out = datasets(file_run)
+    if sorted(ref.keys()) != sorted(out.keys()) or len(ref) == 0:
+        return False
+    return all(np.array_equal(ref[name], out[name]) for name in ref)
+
+def cleanup():
+    for threads in thread_counts:
+        if os.path.isdir(input_name(threads)):
+            shutil.rmtree(input_name(threads))
+
+if __name__ == '__main__':
+
+    executable = 'bin/enzo-e'
+
+    # this script can either be called from the base repository or from
+    # the subdirectory: input/PPM
+    if os.getcwd()[-9:] == 'input/PPM':
+        os.chdir('../../')
+    if not os.path.isfile(executable):
+        raise RuntimeError("Can't locate the executable: " + executable)
+
+    launcher = sys.argv[1:]
+
+    times = {threads : run(launcher, executable, threads)
+             for threads in thread_counts}
+
+    passed = True
+    print("threads     time   speedup  output")
+    for threads in thread_counts:
+        same = identical(threads)
+        passed = passed and same
+        print("{:7d} {:8.3f} s {:8.3f}  {}".format
+              (threads, times[threads], times[1]/times[threads],
+               "identical" if same else "DIFFERS"))
+    print("PASSED" if passed else "FAILED")
+    cleanup()
+
+    if passed:
+        sys.exit(0)
+    else:
+        sys.exit(3)
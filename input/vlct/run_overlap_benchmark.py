@@ -0,0 +1,60 @@
+#!/bin/python
+
+# Benchmarks Method:mhd_vlct:overlap_refresh, which integrates a copy of
+# each block while its ghost zones are refreshed and then re-integrates
+# the slabs within the stencil depth of the block faces.
+# - This script expects to be called from the root level of the repository
+#   OR at the same level where its defined
+#
+# Runs the same 128^3 problem on 16^3 and 32^3 blocks with overlap off and
+# on, and reports the wall-clock time of each run.  Overlap recomputes
+# cells near block faces, so it only wins when the refresh it hides costs
+# more than the extra integration; run with several processes (and
+# nodes) to measure that, e.g.
+#
+#     python3 input/vlct/run_overlap_benchmark.py "charmrun +p8" 3
+
+import sys
+import time
+
+from testing_utils import EnzoEWrapper, prep_cur_dir
+
+input_template = 'input/vlct/overlap_benchmark/overlap_benchmark_{}_{}.in'
+block_sizes = [16, 32]
+modes = ['off', 'on']
+
+def run_benchmark(executable, repeat = 1):
+    call_run = EnzoEWrapper(executable, input_template)
+    times = {}
+    for size in block_sizes:
+        for mode in modes:
+            best = None
+            for i in range(repeat):
+                start = time.time()
+                call_run(mode, size)
+                elapsed = time.time() - start
+                best = elapsed if best is None else min(best, elapsed)
+            times[(size, mode)] = best
+    return times
+
+def analyze(times):
+    print("block   off (s)   on (s)   speedup")
+    for size in block_sizes:
+        t_off = times[(size, 'off')]
+        t_on  = times[(size, 'on')]
+        print("{:2d}^3  {:8.3f} {:8.3f} {:8.3f}".format
+              (size, t_off, t_on, t_off/t_on))
+
+if __name__ == '__main__':
+
+    executable = 'bin/enzo-e'
+
+    # this script can either be called from the base repository or from
+    # the subdirectory: input/vlct
+    prep_cur_dir(executable)
+
+    launcher = sys.argv[1] if len(sys.argv) > 1 else ''
+    repeat = int(sys.argv[2]) if len(sys.argv) > 2 else 1
+
+    times = run_benchmark((launcher + ' ' + executable).strip(), repeat)
+    analyze(times)
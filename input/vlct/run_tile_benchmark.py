@@ -0,0 +1,74 @@
+#!/bin/python
+
+# Benchmarks the fused (tiled) flux computation of the VLCT integrator
+# against the default path that sweeps each stage over the whole block.
+# - This script expects to be called from the root level of the repository
+#   OR at the same level where its defined
+#
+# Both runs evolve the same 64^3 block for a fixed number of cycles. The
+# script reports the wall-clock time of each run and checks that the final
+# snapshots are identical (tiling does not change the results).
+
+import os.path
+import shutil
+import sys
+import time
+
+from testing_utils import CalcSimL1Norm, EnzoEWrapper, prep_cur_dir
+
+input_template = 'input/vlct/tile_benchmark/tile_benchmark_{}.in'
+modes = ['untiled', 'tiled']
+
+def run_benchmark(executable, repeat = 1):
+    call_run = EnzoEWrapper(executable, input_template)
+    times = {}
+    for mode in modes:
+        best = None
+        for i in range(repeat):
+            start = time.time()
+            call_run(mode)
+            elapsed = time.time() - start
+            best = elapsed if best is None else min(best, elapsed)
+        times[mode] = best
+    return times
+
+def analyze(times):
+    for mode in modes:
+        print("{:8s} {:8.3f} s".format(mode, times[mode]))
+    print("speedup  {:8.3f}".format(times['untiled']/times['tiled']))
+
+    l1_func = CalcSimL1Norm("tools/l1_error_norm.py",
+                            default_fields = ["density", "velocity_x",
+                                              "velocity_y", "velocity_z",
+                                              "total_energy", "bfield_x",
+                                              "bfield_y", "bfield_z"])
+    norm = l1_func("tile_benchmark_untiled", "tile_benchmark_tiled")
+    passed = (norm == 0.)
+    print("L1 error norm between runs {:e}: {}".format
+          (norm, "PASSED" if passed else "FAILED"))
+    return passed
+
+def cleanup():
+    for mode in modes:
+        dir_name = "tile_benchmark_{}".format(mode)
+        if os.path.isdir(dir_name):
+            shutil.rmtree(dir_name)
+
+if __name__ == '__main__':
+
+    executable = 'bin/enzo-e'
+
+    # this script can either be called from the base repository or from
+    # the subdirectory: input/vlct
+    prep_cur_dir(executable)
+
+    repeat = int(sys.argv[1]) if len(sys.argv) > 1 else 1
+
+    times = run_benchmark(executable, repeat)
+    passed = analyze(times)
+    cleanup()
+
+    if passed:
+        sys.exit(0)
+    else:
+        sys.exit(3)
@@ -12,6 +12,7 @@
 // System includes
 //----------------------------------------------------------------------
 
+#include <deque>
 #include <limits>
 #include <boost/filesystem.hpp>
 #include "pngwriter.h"
@@ -42,9 +43,11 @@ enum meta_type {
 #include "io_InputData.hpp"
 
 #include "io_Output.hpp"
+#include "io_OutputStage.hpp"
 #include "io_OutputImage.hpp"
 #include "io_OutputData.hpp"
 #include "io_OutputCheckpoint.hpp"
+#include "io_OutputShared.hpp"
 
 #include "io_Schedule.hpp"
 #include "io_ScheduleList.hpp"
@@ -16,6 +16,7 @@
 
 #include <stack>
 #include <memory>
+#include <atomic>
 
 //----------------------------------------------------------------------
 // Component class includes
@@ -372,6 +372,9 @@ class FixedDimArray_
   ///           out behavior used by both CelloArray and TempArray (a helper
   ///           class that allows for numpy inspired elementwise assignment)
 
+  // lets CelloArray<T,D+1>::leading_subarray initialize a CelloArray<T,D>
+  template<typename, std::size_t> friend class CelloArray;
+
 public: // interface
 
   typedef T value_type;
@@ -932,7 +935,40 @@ public: // interface
     }
     return true;
   }
-  
+
+  /// Return a view of the (D-1)-dimensional array at the specified index of
+  /// the first (slowest varying) dimension. This is the analog of numpy's
+  /// `arr[index]`.
+  ///
+  /// The view shares data with this array. For example, if `arr` has shape
+  /// `(n, mz, my, mx)`, then `arr.leading_subarray(i)` is a 3D array of shape
+  /// `(mz, my, mx)` that aliases `arr(i, :, :, :)`.
+  template<std::size_t DD = D>
+  CelloArray<T,DD-1> leading_subarray(int index) const noexcept;
+
 };
 
+//----------------------------------------------------------------------
+
+template<typename T, std::size_t D>
+template<std::size_t DD>
+CelloArray<T,DD-1> CelloArray<T,D>::leading_subarray(int index) const noexcept
+{
+  static_assert(DD == D, "leading_subarray's template argument can't be set");
+  static_assert(D > 1, "leading_subarray requires an array with D > 1");
+  ASSERT2("CelloArray::leading_subarray",
+          "index %d doesn't lie in the first dimension of size %ld",
+          index, (long)this->shape_[0],
+          (index >= 0) && (index < this->shape_[0]));
+
+  CelloArray<T,D-1> out;
+  out.init_helper_(this->shared_data_, this->shape_ + 1,
+                   this->offset_ + index * this->stride_[0]);
+  // copy the strides in case this is a subarray
+  for (std::size_t i = 0; i + 1 < D; i++){
+    out.stride_[i] = this->stride_[i+1];
+  }
+  return out;
+}
+
 #endif /* ARRAY_CELLO_ARRAY_HPP */
@@ -14,8 +14,10 @@
 #include "charm_reductions.hpp"
 #include "charm_MappingArray.hpp"
 #include "charm_MappingTree.hpp"
+#include "charm_CelloLB.hpp"
 
 #include "charm_MsgRefresh.hpp"
+#include "charm_MsgRefreshAggregate.hpp"
 #include "charm_MsgCoarsen.hpp"
 #include "charm_MsgRefine.hpp"
 #include "charm_FieldMsg.hpp"
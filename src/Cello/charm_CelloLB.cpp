@@ -0,0 +1,204 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     charm_CelloLB.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    Load balancer preserving Block ordering
+
+#include <algorithm>
+#include <tuple>
+
+#include "auto_config.def"
+#include "cello.hpp"
+#include "parameters.hpp"
+#include "mesh.hpp"
+#include "charm.hpp"
+
+//----------------------------------------------------------------------
+
+std::map<CmiUInt8,Index> CelloLB::block_index_;
+
+int    CelloLB::num_steps_       = 0;
+double CelloLB::load_avg_        = 0.0;
+double CelloLB::load_max_before_ = 0.0;
+double CelloLB::load_max_after_  = 0.0;
+
+#define CELLO_LB_DESCRIPTION \
+  "divide objects in process order into contiguous equal-load segments"
+
+#if CHARM_VERSION < 70000
+
+static void create_cello_lb()
+{
+  int seqno = LBDatabaseObj()->getLoadbalancerTicket();
+  CProxy_CelloLB::ckNew(CkLBOptions(seqno));
+}
+
+static BaseLB * allocate_cello_lb()
+{
+  return new CelloLB((CkMigrateMessage*)NULL);
+}
+
+#endif
+
+//----------------------------------------------------------------------
+
+void cello_lb_init()
+{
+#if CHARM_VERSION < 70000
+  LBRegisterBalancer
+    ("CelloLB", create_cello_lb, allocate_cello_lb, CELLO_LB_DESCRIPTION);
+#else
+  LBRegisterBalancer<CelloLB> ("CelloLB", CELLO_LB_DESCRIPTION);
+#endif
+}
+
+//----------------------------------------------------------------------
+
+namespace {
+
+  /// Position of a Block along the Mesh:mapping curve: the curve key
+  /// of its root-level ancestor, then its child indices at each level
+  /// with 3 bits per level, then its level so parents precede their
+  /// first child
+  typedef std::tuple<unsigned long long,unsigned long long,int> BlockKey;
+
+  BlockKey block_key (Index index, int mapping_type, int nx, int ny, int nz)
+  {
+    int ix,iy,iz;
+    index.array(&ix,&iy,&iz);
+    const int level = index.level();
+    unsigned long long path = 0;
+    for (int i=1; i<=level; i++) {
+      int icx,icy,icz;
+      index.child(i,&icx,&icy,&icz);
+      const unsigned long long ic = (icz << 2) | (icy << 1) | icx;
+      path |= ic << (3*(INDEX_BITS_TREE - i));
+    }
+    return BlockKey
+      (MappingArray::curve_key(mapping_type,ix,iy,iz,nx,ny,nz),path,level);
+  }
+
+}
+
+//======================================================================
+
+CelloLB::CelloLB(const CkLBOptions & options)
+  : CBase_CelloLB(options)
+{
+  lbname = "CelloLB";
+}
+
+//----------------------------------------------------------------------
+
+void CelloLB::set_index (int n, const CmiUInt8 * id, const int * v3)
+{
+  for (int i=0; i<n; i++) {
+    Index index;
+    index.set_values(v3 + 3*i);
+    block_index_[id[i]] = index;
+  }
+}
+
+//----------------------------------------------------------------------
+
+void CelloLB::work (LDStats * stats)
+{
+  const int num_objs  = stats->n_objs;
+  const int num_procs = stats->nprocs();
+
+  // processes that may receive objects, in order
+
+  std::vector<int> proc_list;
+  for (int ip=0; ip<num_procs; ip++) {
+    if (stats->procs[ip].available) proc_list.push_back(ip);
+  }
+  const int num_avail = proc_list.size();
+
+  if (num_avail == 0) return;
+
+  std::vector<double> load_before(num_procs,0.0);
+  std::vector<double> load_after (num_procs,0.0);
+
+  // order migratable objects by current process, then along the
+  // Mesh:mapping curve; objects with no recorded Index follow, in
+  // their current relative order
+
+  std::vector<int> obj_list;
+  double load_total = 0.0;
+  double load_fixed = 0.0;
+  for (int io=0; io<num_objs; io++) {
+    const LDObjData & obj = stats->objData[io];
+    const int ip = stats->from_proc[io];
+    load_before[ip] += obj.wallTime;
+    if (obj.migratable) {
+      obj_list.push_back(io);
+      load_total += obj.wallTime;
+    } else {
+      load_after[ip] += obj.wallTime;
+      load_fixed += obj.wallTime;
+    }
+  }
+
+  const int mapping_type =
+    MappingArray::mapping_type(cello::config()->mesh_mapping);
+  int nx,ny,nz;
+  cello::hierarchy()->root_blocks(&nx,&ny,&nz);
+
+  std::vector<bool> has_key(num_objs,false);
+  std::vector<BlockKey> key(num_objs);
+#if CHARM_VERSION >= 60800
+  for (size_t k=0; k<obj_list.size(); k++) {
+    const int io = obj_list[k];
+    auto it = block_index_.find(stats->objData[io].objID());
+    if (it != block_index_.end()) {
+      has_key[io] = true;
+      key[io] = block_key(it->second,mapping_type,nx,ny,nz);
+    }
+  }
+#endif
+  block_index_.clear();
+
+  std::stable_sort
+    (obj_list.begin(),obj_list.end(),
+     [stats,&has_key,&key] (int io_1, int io_2)
+     {
+       const int ip_1 = stats->from_proc[io_1];
+       const int ip_2 = stats->from_proc[io_2];
+       if (ip_1 != ip_2) return ip_1 < ip_2;
+       if (has_key[io_1] != has_key[io_2]) return bool(has_key[io_1]);
+       return has_key[io_1] && (key[io_1] < key[io_2]);
+     });
+
+  // assign each object to the segment containing its midpoint in the
+  // cumulative load
+
+  if (load_total > 0.0) {
+    double load_prefix = 0.0;
+    for (size_t k=0; k<obj_list.size(); k++) {
+      const int io = obj_list[k];
+      const double load = stats->objData[io].wallTime;
+      const double load_mid = load_prefix + 0.5*load;
+      const int is = std::min
+        (num_avail - 1, int(num_avail * load_mid / load_total));
+      const int ip = proc_list[is];
+      stats->assign(io,ip);
+      load_after[ip] += load;
+      load_prefix += load;
+    }
+  } else {
+    for (size_t k=0; k<obj_list.size(); k++) {
+      const int io = obj_list[k];
+      const int ip = stats->from_proc[io];
+      stats->assign(io,ip);
+      load_after[ip] += stats->objData[io].wallTime;
+    }
+  }
+
+  // save load imbalance before and after for Performance output
+
+  load_avg_ = (load_total + load_fixed) / num_avail;
+  load_max_before_ = *std::max_element(load_before.begin(),load_before.end());
+  load_max_after_  = *std::max_element(load_after.begin(),load_after.end());
+  ++num_steps_;
+}
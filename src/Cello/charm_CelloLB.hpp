@@ -0,0 +1,83 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     charm_CelloLB.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Parallel] Declaration of the CelloLB load balancer
+
+#ifndef CHARM_CELLO_LB_HPP
+#define CHARM_CELLO_LB_HPP
+
+#include "CentralLB.h"
+#include "simulation.decl.h"
+
+/// Register CelloLB with the Charm++ load balancing framework
+extern void cello_lb_init();
+
+class CelloLB : public CBase_CelloLB {
+
+  /// @class    CelloLB
+  /// @ingroup  Charm
+  /// @brief    [\ref Parallel] Load balancer preserving Block ordering
+  ///
+  /// Centralized load balancer that divides Blocks among processes in
+  /// contiguous segments of equal total load.  Blocks are ordered by
+  /// their current process, then by their position along the
+  /// Mesh:mapping curve: the curve key of their root-level ancestor,
+  /// followed by their child indices at each level.  Block Indices
+  /// are sent to process 0 by Simulation::p_balance_set_index()
+  /// before AtSync(); objects with no Index keep Charm++'s order.
+  /// Block loads are either measured by Charm++, or given by
+  /// Block::cost() if Balance:cost_model is true.  Select using the
+  /// "+balancer CelloLB" command-line argument.
+
+public:
+
+  CelloLB (const CkLBOptions & options);
+
+  /// CHARM++ migration constructor
+  CelloLB (CkMigrateMessage *m)
+    : CBase_CelloLB(m)
+  { lbname = "CelloLB"; }
+
+  /// Assign objects to processes
+  void work (LDStats * stats);
+
+  /// Record the Index of n Blocks given their load balancing object
+  /// ids and Index values, for ordering in the next work()
+  static void set_index (int n, const CmiUInt8 * id, const int * v3);
+
+  /// Number of load balancing steps performed on this process
+  static int num_steps()
+  { return num_steps_; }
+
+  /// Average process load in the last load balancing step
+  static double load_avg()
+  { return load_avg_; }
+
+  /// Maximum process load before the last load balancing step
+  static double load_max_before()
+  { return load_max_before_; }
+
+  /// Maximum process load after the last load balancing step
+  static double load_max_after()
+  { return load_max_after_; }
+
+private:
+
+  bool QueryBalanceNow(int step)
+  { return true; }
+
+private: // attributes
+
+  /// Index values of Blocks by load balancing object id
+  static std::map<CmiUInt8,Index> block_index_;
+
+  static int num_steps_;
+  static double load_avg_;
+  static double load_max_before_;
+  static double load_max_after_;
+
+};
+
+#endif /* CHARM_CELLO_LB_HPP */
@@ -5,16 +5,41 @@
 /// @date     2013-04-22
 /// @brief    Mapping of Charm++ array Index to processors
 
+#include <algorithm>
+
+#include "cello.hpp"
+#include "parameters.hpp"
 #include "charm.hpp"
 
 //======================================================================
 
 MappingArray::MappingArray(int nx, int ny, int nz)
-  :  CkArrayMap()
+  :  CkArrayMap(),
+     mapping_type_(mapping_unknown),
+     process_()
 {
   nx_ = nx;
   ny_ = ny;
   nz_ = nz;
+
+  mapping_type_ = mapping_type(cello::config()->mesh_mapping);
+
+  initialize_process_();
+}
+
+//----------------------------------------------------------------------
+
+int MappingArray::mapping_type (std::string mapping)
+{
+  if      (mapping == "linear")  return mapping_linear;
+  else if (mapping == "morton")  return mapping_morton;
+  else if (mapping == "hilbert") return mapping_hilbert;
+  else {
+    ERROR1 ("MappingArray::mapping_type()",
+	    "Unknown Mesh:mapping type \"%s\"",
+	    mapping.c_str());
+  }
+  return mapping_unknown;
 }
 
 //----------------------------------------------------------------------
@@ -33,8 +58,140 @@ int MappingArray::procNum(int, const CkArrayIndex &idx) {
   int ix,iy,iz;
   in.array    (&ix,&iy,&iz);
 
-  int index = CkNumPes()*(ix + nx_*(iy + ny_*iz)) / (nx_*ny_*nz_);
+  if (mapping_type_ == mapping_linear) {
+
+    int index = CkNumPes()*(ix + nx_*(iy + ny_*iz)) / (nx_*ny_*nz_);
   
-  return index;
+    return index;
+
+  } else {
+
+    return process_[ix + nx_*(iy + ny_*iz)];
+
+  }
 }
 
+//----------------------------------------------------------------------
+
+void MappingArray::initialize_process_()
+{
+  process_.clear();
+
+  if (mapping_type_ == mapping_linear) return;
+
+  // sort root-level Blocks by their position along the curve
+
+  const int n = nx_*ny_*nz_;
+
+  std::vector< std::pair<unsigned long long,int> > key_list(n);
+
+  for (int iz=0; iz<nz_; iz++) {
+    for (int iy=0; iy<ny_; iy++) {
+      for (int ix=0; ix<nx_; ix++) {
+	const int i = ix + nx_*(iy + ny_*iz);
+	const unsigned long long key =
+	  curve_key(mapping_type_,ix,iy,iz,nx_,ny_,nz_);
+	key_list[i] = std::make_pair(key,i);
+      }
+    }
+  }
+
+  std::sort (key_list.begin(),key_list.end());
+
+  // divide curve evenly among processes
+
+  process_.resize(n);
+  for (int k=0; k<n; k++) {
+    process_[key_list[k].second] = (long long)CkNumPes()*k / n;
+  }
+}
+
+//----------------------------------------------------------------------
+
+unsigned long long MappingArray::curve_key
+(int mapping_type, int ix, int iy, int iz, int nx, int ny, int nz)
+{
+  const int rank = rank_(ny,nz);
+  const int num_bits = num_bits_(nx,ny,nz);
+  if (mapping_type == mapping_morton) {
+    return key_morton_(ix,iy,iz,rank,num_bits);
+  } else if (mapping_type == mapping_hilbert) {
+    return key_hilbert_(ix,iy,iz,rank,num_bits);
+  } else {
+    return ix + (unsigned long long)(nx)*(iy + (unsigned long long)(ny)*iz);
+  }
+}
+
+//----------------------------------------------------------------------
+
+int MappingArray::num_bits_(int nx, int ny, int nz)
+{
+  const int n = std::max(nx,std::max(ny,nz));
+  int num_bits = 1;
+  while ((1 << num_bits) < n) ++num_bits;
+  return num_bits;
+}
+
+//----------------------------------------------------------------------
+
+unsigned long long MappingArray::key_morton_
+(int ix, int iy, int iz, int rank, int num_bits)
+{
+  const unsigned x3[3] = {unsigned(ix),unsigned(iy),unsigned(iz)};
+
+  // interleave bits, most significant first
+
+  unsigned long long key = 0;
+  for (int ib=num_bits-1; ib>=0; ib--) {
+    for (int axis=0; axis<rank; axis++) {
+      key = (key << 1) | ((x3[axis] >> ib) & 1);
+    }
+  }
+  return key;
+}
+
+//----------------------------------------------------------------------
+
+unsigned long long MappingArray::key_hilbert_
+(int ix, int iy, int iz, int rank, int num_bits)
+{
+  // Convert coordinates to the "transposed" Hilbert index using
+  // Skilling's algorithm (AIP Conf. Proc. 707, 381 (2004)), then
+  // interleave bits as for the Morton key
+
+  unsigned x3[3] = {unsigned(ix),unsigned(iy),unsigned(iz)};
+
+  const unsigned m = 1u << (num_bits - 1);
+
+  // inverse undo excess work
+
+  for (unsigned q = m; q > 1; q >>= 1) {
+    const unsigned p = q - 1;
+    for (int axis=0; axis<rank; axis++) {
+      if (x3[axis] & q) {
+	x3[0] ^= p;
+      } else {
+	const unsigned t = (x3[0] ^ x3[axis]) & p;
+	x3[0]    ^= t;
+	x3[axis] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+
+  for (int axis=1; axis<rank; axis++) x3[axis] ^= x3[axis-1];
+  unsigned t = 0;
+  for (unsigned q = m; q > 1; q >>= 1) {
+    if (x3[rank-1] & q) t ^= q - 1;
+  }
+  for (int axis=0; axis<rank; axis++) x3[axis] ^= t;
+
+  unsigned long long key = 0;
+  for (int ib=num_bits-1; ib>=0; ib--) {
+    for (int axis=0; axis<rank; axis++) {
+      key = (key << 1) | ((x3[axis] >> ib) & 1);
+    }
+  }
+  return key;
+}
@@ -11,6 +11,13 @@
 #include "cello.hpp"
 #include "simulation.decl.h"
 
+enum mapping_type {
+  mapping_unknown,
+  mapping_linear,
+  mapping_morton,
+  mapping_hilbert
+};
+
 class MappingArray: public CkArrayMap {
 
   /// @class    MappingArray
@@ -18,7 +25,12 @@ class MappingArray: public CkArrayMap {
   /// @brief    [\ref Parallel] Class for mapping Blocks to processors
   ///
   /// This class defines how to map a 3D array of Charm++ chares to
-  /// processes
+  /// processes.  Root-level Blocks are ordered either
+  /// lexicographically ("linear") or along a Morton or Hilbert
+  /// space-filling curve, as given by the Mesh:mapping parameter, and
+  /// the ordered list is divided evenly among processes.  Refined
+  /// Blocks are mapped to the same process as their root-level
+  /// ancestor.
 
 public:
 
@@ -29,7 +41,9 @@ public:
   /// CHARM++ migration constructor for PUP::able
   MappingArray (CkMigrateMessage *m)
     : CkArrayMap(m),
-      nx_(0),ny_(0),nz_(0)
+      nx_(0),ny_(0),nz_(0),
+      mapping_type_(mapping_unknown),
+      process_()
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -41,12 +55,54 @@ public:
     p | nx_;
     p | ny_;
     p | nz_;
+    p | mapping_type_;
+    if (p.isUnpacking()) initialize_process_();
   }
 
-private:
+  /// Return the position of root-level Block (ix,iy,iz) in an
+  /// nx*ny*nz array of Blocks along the curve of the given
+  /// mapping_type: lexicographic for mapping_linear, or a Morton or
+  /// Hilbert space-filling curve
+  static unsigned long long curve_key
+  (int mapping_type, int ix, int iy, int iz, int nx, int ny, int nz);
+
+  /// Return the mapping_type named by the Mesh:mapping parameter
+  static int mapping_type (std::string mapping);
+
+private: // functions
+
+  /// Compute the process of each root-level Block for space-filling
+  /// curve mappings
+  void initialize_process_();
+
+  /// Return the position of the given root-level Block along the
+  /// Morton curve
+  static unsigned long long key_morton_
+  (int ix, int iy, int iz, int rank, int num_bits);
+
+  /// Return the position of the given root-level Block along the
+  /// Hilbert curve
+  static unsigned long long key_hilbert_
+  (int ix, int iy, int iz, int rank, int num_bits);
+
+  /// Number of bits required for the largest array axis
+  static int num_bits_(int nx, int ny, int nz);
+
+  /// Number of array axes with more than one Block
+  static int rank_(int ny, int nz)
+  { return (nz > 1) ? 3 : ((ny > 1) ? 2 : 1); }
+
+private: // attributes
 
   int nx_, ny_, nz_;
 
+  /// How Blocks are ordered before being divided among processes
+  int mapping_type_;
+
+  /// Process of each root-level Block indexed by ix + nx*(iy + ny*iz)
+  /// (empty for linear mapping)
+  std::vector<int> process_;
+
 };
 
 #endif /* CHARM_MAPPING_ARRAY_HPP */
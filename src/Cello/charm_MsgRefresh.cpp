@@ -22,7 +22,9 @@ MsgRefresh::MsgRefresh()
       is_local_(true),
       id_refresh_(-1),
       data_msg_(nullptr),
-      buffer_(nullptr)
+      buffer_(nullptr),
+      array_(nullptr),
+      size_array_(0)
 {
   ++counter[cello::index_static()]; 
 }
@@ -36,6 +38,8 @@ MsgRefresh::~MsgRefresh()
   data_msg_ = nullptr;
   CkFreeMsg (buffer_);
   buffer_=nullptr;
+  delete [] array_;
+  array_ = nullptr;
 }
 
 //----------------------------------------------------------------------
@@ -60,16 +64,12 @@ void * MsgRefresh::pack (MsgRefresh * msg)
 #endif  
   if (msg->buffer_ != nullptr) return msg->buffer_;
 
-  int size = 0;
+  //--------------------------------------------------
+  //  1. determine buffer size
+  //--------------------------------------------------
 
-  size += sizeof(int); // id_refresh
-  size += sizeof(int);  // have_data
-  int have_data = (msg->data_msg_ != nullptr);
-  
-  if (have_data) {
-    // data_msg_
-    size += msg->data_msg_->data_size();
-  }
+  const int size = (msg->array_ != nullptr) ?
+    msg->size_array_ : msg->data_size();
 
   //--------------------------------------------------
   //  2. allocate buffer using CkAllocBuffer()
@@ -81,22 +81,15 @@ void * MsgRefresh::pack (MsgRefresh * msg)
   //  3. serialize message data into buffer 
   //--------------------------------------------------
 
-  union {
-    char * pc;
-    int  * pi;
-  };
-
-  pc = buffer;
+  char * pc = buffer;
 
-  (*pi++) = msg->id_refresh_;
-#ifdef DEBUG_MSG_REFRESH
-  CkPrintf ("DEBUG_MSG_REFRESH MsgRefresh::pack id_refresh=%d\n",msg->id_refresh_);
-#endif  
-
-  have_data = (msg->data_msg_ != nullptr);
-  (*pi++) = have_data;
-  if (have_data) {
-    pc = msg->data_msg_->save_data(pc);
+  if (msg->array_ != nullptr) {
+    // message was unpacked from an aggregate message and has not been
+    // used: forward the original serialized data
+    memcpy (pc,msg->array_,size);
+    pc += size;
+  } else {
+    pc = msg->save_data(pc);
   }
 
   delete msg;
@@ -133,31 +126,106 @@ MsgRefresh * MsgRefresh::unpack(void * buffer)
   // 2. De-serialize message data from input buffer into the allocated
   // message (must be consistent with pack())
 
+  msg->load_data((char *) buffer);
+
+  // 3. Save the input buffer for freeing later
+
+  msg->buffer_ = buffer;
+
+  return msg;
+}
+
+//----------------------------------------------------------------------
+
+int MsgRefresh::data_size () const
+{
+  int size = 0;
+
+  size += sizeof(int); // id_refresh
+  size += sizeof(int);  // have_data
+
+  if (data_msg_ != nullptr) {
+    // data_msg_
+    size += data_msg_->data_size();
+  }
+
+  return size;
+}
+
+//----------------------------------------------------------------------
+
+char * MsgRefresh::save_data (char * buffer) const
+{
+  union {
+    char * pc;
+    int  * pi;
+  };
+
+  pc = buffer;
+
+  (*pi++) = id_refresh_;
+#ifdef DEBUG_MSG_REFRESH
+  CkPrintf ("DEBUG_MSG_REFRESH MsgRefresh::save_data id_refresh=%d\n",id_refresh_);
+#endif  
+
+  const int have_data = (data_msg_ != nullptr);
+  (*pi++) = have_data;
+  if (have_data) {
+    pc = data_msg_->save_data(pc);
+  }
+
+  return pc;
+}
+
+//----------------------------------------------------------------------
+
+char * MsgRefresh::load_data (char * buffer)
+{
   union {
     char * pc;
     int  * pi;
   };
 
-  pc = (char *) buffer;
+  pc = buffer;
 
-  msg->id_refresh_ = (*pi++) ;
+  id_refresh_ = (*pi++) ;
 #ifdef DEBUG_MSG_REFRESH
-  CkPrintf ("DEBUG_MSG_REFRESH MsgRefresh::pack id_refresh=%d\n",msg->id_refresh_);
+  CkPrintf ("DEBUG_MSG_REFRESH MsgRefresh::load_data id_refresh=%d\n",id_refresh_);
 #endif  
 
   int have_data = (*pi++);
   if (have_data) {
-    msg->data_msg_ = new DataMsg;
-    pc = msg->data_msg_->load_data(pc);
+    data_msg_ = new DataMsg;
+    pc = data_msg_->load_data(pc);
   } else {
-    msg->data_msg_ = nullptr;
+    data_msg_ = nullptr;
   }
 
-  // 3. Save the input buffer for freeing later
+  return pc;
+}
 
-  msg->buffer_ = buffer;
+//----------------------------------------------------------------------
 
-  return msg;
+void MsgRefresh::load_array (const char * array, int n)
+{
+  ASSERT("MsgRefresh::load_array()",
+         "load_array() called on a message that already has data",
+         (data_msg_ == nullptr && array_ == nullptr));
+
+  // DataMsg refers to field data in place, so keep a private copy
+
+  array_ = new char [n];
+  size_array_ = n;
+  memcpy (array_,array,n);
+
+  is_local_ = false;
+
+  char * pc = load_data(array_);
+
+  ASSERT2("MsgRefresh::load_array()",
+	  "array size mismatch %ld loaded %d expected",
+	  (pc - array_),n,
+	  (pc - array_) == n);
 }
 
 //----------------------------------------------------------------------
@@ -175,5 +243,7 @@ void MsgRefresh::update (Data * data)
   if (!is_local_) {
       CkFreeMsg (buffer_);
       buffer_ = nullptr;
+      delete [] array_;
+      array_ = nullptr;
   }
 }
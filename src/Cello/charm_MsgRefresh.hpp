@@ -46,6 +46,22 @@ public: // interface
   /// Update the Data with data stored in this message
   void update (Data * data);
 
+  /// Return the number of bytes required to serialize the message
+  int data_size () const;
+
+  /// Serialize the message into the provided buffer, returning the
+  /// next open position in the buffer
+  char * save_data (char * buffer) const;
+
+  /// De-serialize the message from the provided buffer, returning the
+  /// next position in the buffer.  The buffer must persist until
+  /// update() is called.
+  char * load_data (char * buffer);
+
+  /// Copy and de-serialize a message packed with save_data(), e.g. one
+  /// received in a MsgRefreshAggregate message
+  void load_array (const char * array, int n);
+
 public: // static methods
 
   /// Pack data to serialize
@@ -67,6 +83,12 @@ protected: // attributes
   /// Saved Charm++ buffer for deleting after unpack()
   void * buffer_;
 
+  /// Copy of serialized data if created by load_array()
+  char * array_;
+
+  /// Size of array_ in bytes
+  int size_array_;
+
 };
 
 #endif /* CHARM_MSG_HPP */
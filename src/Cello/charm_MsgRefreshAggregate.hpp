@@ -0,0 +1,36 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     charm_MsgRefreshAggregate.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Charm] Declaration of the MsgRefreshAggregate Charm++ Message
+
+#ifndef CHARM_MSG_REFRESH_AGGREGATE_HPP
+#define CHARM_MSG_REFRESH_AGGREGATE_HPP
+
+class MsgRefreshAggregate : public CMessage_MsgRefreshAggregate {
+
+  /// @class    MsgRefreshAggregate
+  /// @ingroup  Charm
+  /// @brief    [\ref Charm] Concatenation of serialized MsgRefresh
+  /// messages from one Block to Blocks on the same destination process
+  ///
+  /// The array a[] contains num_msg entries, each of which is the
+  /// destination Block Index (three ints as returned by Index::values()),
+  /// the size n of the serialized MsgRefresh, and n bytes written by
+  /// MsgRefresh::save_data().
+
+public: // attributes
+  
+  /// Number of MsgRefresh messages in the array
+  int num_msg;
+
+  /// Array length
+  int n;
+
+  /// Array data
+  char * a;
+};
+
+#endif /* CHARM_MSG_REFRESH_AGGREGATE_HPP */
+
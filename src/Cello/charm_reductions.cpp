@@ -11,30 +11,35 @@ CkReductionMsg * r_reduce_performance(int n, CkReductionMsg ** msgs)
 {
   if (n <= 0) return NULL;
 
+  // header is followed by num_sum values to sum, num_max values to
+  // maximize, and num_sum_double doubles (stored bitwise) to sum
+
   long long num_sum = ((long long*) (msgs[0]->getData()))[0];
   long long num_max = ((long long*) (msgs[0]->getData()))[1];
+  long long num_sum_double = ((long long*) (msgs[0]->getData()))[2];
+
+  static_assert (sizeof(double) == sizeof(long long),
+                 "r_reduce_performance() stores doubles in long long");
 
-  const int length = 2 + num_sum + num_max;
+  const int length = 3 + num_sum + num_max + num_sum_double;
   std::vector<long long> accum;
   ASSERT1 ("r_reduce_performance",
 	   "Sanity check failed on expected accumulator array %d",
-	   length, (length < 500));
-  accum.resize(length);
-  accum.clear();
+	   length, (length < 5000));
 
-  // save length
-  accum [0] = num_sum;
-  accum [1] = num_max;
+  // initialize with first message so maxima may be negative
+  const long long * values_0 = (const long long *) msgs[0]->getData();
+  accum.assign(values_0, values_0 + length);
 
-  // sum remaining values
-  for (int i=0; i<n; i++) {
+  // reduce remaining values
+  for (int i=1; i<n; i++) {
     ASSERT4("r_reduce_performance()",
 	    "CkReductionMsg actual size %d is different from expected %lu num_sum %d num_max %d",
 	    msgs[i]->getSize(),length*sizeof(long long),num_sum,num_max,
 	    (msgs[i]->getSize() == length*sizeof(long long)));
       
     long long * values = (long long *) msgs[i]->getData();
-    int j = 2;
+    int j = 3;
     for (int count=1; count <= num_sum; count++) {
       accum [j] += values[j];
       ++j;
@@ -43,6 +48,14 @@ CkReductionMsg * r_reduce_performance(int n, CkReductionMsg ** msgs)
       accum [j] = std::max(accum[j],values[j]);
       ++j;
     }
+    for (int count=1; count <= num_sum_double; count++) {
+      double a, b;
+      memcpy (&a, &accum[j], sizeof(double));
+      memcpy (&b, &values[j], sizeof(double));
+      a += b;
+      memcpy (&accum[j], &a, sizeof(double));
+      ++j;
+    }
   }
 
   return CkReductionMsg::buildNew(length*sizeof(long long),&accum[0]);
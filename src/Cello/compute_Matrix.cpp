@@ -68,5 +68,126 @@ void Matrix::residual_ (T * r, T * b,
     }
   }
 }
-//======================================================================
 
+//----------------------------------------------------------------------
+
+void Matrix::jacobi_sweep (int ix, int ib, int ir, int id,
+			   double weight, Block * block,
+			   const int l3[3], const int u3[3]) throw()
+{
+  Field field = block->data()->field();
+
+  int mx,my,mz;
+  field.dimensions(0,&mx,&my,&mz);
+
+  // residual() and diagonal() are computed on a symmetric region
+  // containing the cells to update
+
+  const int m3[3] = {mx,my,mz};
+  int g0 = std::numeric_limits<int>::max();
+  for (int axis=0; axis<3; axis++) {
+    if (m3[axis] > 1) g0 = std::min(g0,std::min(l3[axis],u3[axis]));
+  }
+  g0 = std::max(g0,ghost_depth());
+
+  diagonal (id, block, g0);
+  residual (ir, ib, ix, block, g0);
+
+  void * X = field.values(ix);
+  void * R = field.values(ir);
+  void * D = field.values(id);
+
+  int precision = field.precision(0);
+
+  if      (precision == precision_single)    
+    jacobi_update_((float *)(X), (float *)(R), (float *)(D),
+		   weight,mx,my,mz,l3,u3);
+  else if (precision == precision_double)    
+    jacobi_update_((double *)(X), (double *)(R), (double *)(D),
+		   weight,mx,my,mz,l3,u3);
+  else if (precision == precision_quadruple) 
+    jacobi_update_((long double *)(X), (long double *)(R),
+		   (long double *)(D), weight,mx,my,mz,l3,u3);
+  else 
+    ERROR1("Matrix::jacobi_sweep()", "precision %d not recognized", precision);
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void Matrix::jacobi_update_ (T * x, const T * r, const T * d, double weight,
+			     int mx, int my, int mz,
+			     const int l3[3], const int u3[3]) throw()
+{
+  const int ix0 = (mx > 1) ? l3[0] : 0;
+  const int iy0 = (my > 1) ? l3[1] : 0;
+  const int iz0 = (mz > 1) ? l3[2] : 0;
+  const int ix1 = (mx > 1) ? mx - u3[0] : 1;
+  const int iy1 = (my > 1) ? my - u3[1] : 1;
+  const int iz1 = (mz > 1) ? mz - u3[2] : 1;
+
+  for (int iz=iz0; iz<iz1; iz++) {
+    for (int iy=iy0; iy<iy1; iy++) {
+      for (int ix=ix0; ix<ix1; ix++) {
+
+	const int i=ix + mx*(iy + my*iz);
+
+	x[i] += weight * r[i] / d[i];
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+long double Matrix::matvec_dot (int iy, int ix, int iw,
+				Block * block, int g0) throw()
+{
+  matvec(iy,ix,block,g0);
+
+  Field field = block->data()->field();
+
+  int mx,my,mz;
+  field.dimensions(0,&mx,&my,&mz);
+  int gx,gy,gz;
+  field.ghost_depth(0,&gx,&gy,&gz);
+
+  void * Y = field.values(iy);
+  void * W = field.values(iw);
+
+  int precision = field.precision(0);
+
+  if      (precision == precision_single)    
+    return dot_((float *)(Y), (float *)(W), mx,my,mz,gx,gy,gz);
+  else if (precision == precision_double)    
+    return dot_((double *)(Y), (double *)(W), mx,my,mz,gx,gy,gz);
+  else if (precision == precision_quadruple) 
+    return dot_((long double *)(Y), (long double *)(W), mx,my,mz,gx,gy,gz);
+  else 
+    ERROR1("Matrix::matvec_dot()", "precision %d not recognized", precision);
+
+  return 0.0;
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+long double Matrix::dot_ (const T * y, const T * w,
+			  int mx, int my, int mz,
+			  int gx, int gy, int gz) throw()
+{
+  long double sum = 0.0;
+  for (int iz=gz; iz<mz-gz; iz++) {
+    for (int iy=gy; iy<my-gy; iy++) {
+      for (int ix=gx; ix<mx-gx; ix++) {
+
+	const int i=ix + mx*(iy + my*iz);
+
+	sum += y[i]*w[i];
+      }
+    }
+  }
+  return sum;
+}
+
+//======================================================================
@@ -56,6 +56,21 @@ public: // virtual functions
   /// How many ghost zones required for matvec
   virtual int ghost_depth() const throw() = 0;
 
+  /// Perform one weighted Jacobi sweep X <-- X + w*(B - A*X)/D on
+  /// cells at least l3[] and u3[] cells from the lower and upper
+  /// Block edges.  Fields ir and id may be used as scratch.  The
+  /// default calls diagonal() and residual(); override with a fused
+  /// kernel where possible
+  virtual void jacobi_sweep (int ix, int ib, int ir, int id,
+			     double weight, Block * block,
+			     const int l3[3], const int u3[3]) throw();
+
+  /// Apply the matrix Y <-- A*X and return DOT(Y,W) over the Block
+  /// interior.  The default calls matvec() and then computes the
+  /// dot product; override with a fused kernel where possible
+  virtual long double matvec_dot (int iy, int ix, int iw,
+				  Block * block, int g0=1) throw();
+
 protected: // functions
 
   template<class T>
@@ -63,6 +78,16 @@ protected: // functions
 		 int mx, int my, int mz,
 		 int ig0) throw();
 
+  template<class T>
+  void jacobi_update_ (T * x, const T * r, const T * d, double weight,
+		       int mx, int my, int mz,
+		       const int l3[3], const int u3[3]) throw();
+
+  template<class T>
+  long double dot_ (const T * y, const T * w,
+		    int mx, int my, int mz,
+		    int gx, int gy, int gz) throw();
+
 };
 
 #endif /* COMPUTE_MATRIX_HPP */
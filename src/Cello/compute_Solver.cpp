@@ -138,7 +138,15 @@ void Solver::begin_(Block * block)
 	    block->name().c_str(),index_,name_.c_str());
 #endif  
 	    
+  block->solver_time_start();
+
   block->push_solver(index_);
+
+  // solvers span many entry methods, so time while any Block is inside
+
+  Simulation * simulation = cello::simulation();
+  simulation->performance()->enter_region
+    (simulation->perf_region_solver(index_));
 }
 
 //----------------------------------------------------------------------
@@ -156,6 +164,12 @@ void Solver::end_(Block * block)
 	  "Solver mismatch was %d expected %d",
 	  index,index_,(index == index_));
 
+  block->solver_time_stop();
+
+  Simulation * simulation = cello::simulation();
+  simulation->performance()->exit_region
+    (simulation->perf_region_solver(index_));
+
   CkCallback(callback_,
 	     CkArrayIndexIndex(block->index()),
 	     block->proxy_array()).send();
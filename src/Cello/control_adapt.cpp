@@ -171,9 +171,14 @@ int Block::adapt_compute_desired_level_(int level_maximum)
   Problem * problem = cello::problem();
   Refine * refine;
 
+  // once any criterion requires refinement the result cannot change,
+  // so only criteria that write a refinement field are still applied
+
   int index_refine = 0;
   while ((refine = problem->refine(index_refine++))) {
 
+    if (adapt_ == adapt_refine && ! refine->has_output()) continue;
+
     Schedule * schedule = refine->schedule();
 
     if ((schedule==NULL) || schedule->write_this_cycle(cycle(),time()) ) {
@@ -774,6 +779,7 @@ void Block::adapt_coarsen_()
 
 void Block::p_adapt_recv_child (MsgCoarsen * msg)
 {
+  TRACER_ENTRY("Block::p_adapt_recv_child");
 
   performance_start_(perf_adapt_update);
 
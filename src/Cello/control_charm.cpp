@@ -53,6 +53,16 @@ void Block::adapt_exit_()
 {
   TRACE_CONTROL("adapt_exit");
 
+  // all Blocks exist after the initial cycle's adapt phase
+
+  if (cycle_ == cello::config()->initial_cycle) {
+    Problem * problem = cello::problem();
+    int index_initial = 0;
+    while (Initial * initial = problem->initial(index_initial++)) {
+      initial->enforce_done();
+    }
+  }
+
   control_sync_quiescence(CkIndex_Main::p_output_enter());
 }
 
@@ -91,6 +101,7 @@ void Block::stopping_exit_()
       // stop if any previous cycle
       performance_stop_(perf_cycle,__FILE__,__LINE__);
     }
+    cello::simulation()->update_timeline();
     // start 
     performance_start_ (perf_cycle,__FILE__,__LINE__);
   }
@@ -38,6 +38,11 @@ void Block::compute_begin_ ()
   cello::simulation()->set_phase(phase_compute);
 
   index_method_ = 0;
+
+  // fields may have changed since the last compute phase, e.g. due to
+  // mesh adaptation or initialization
+  field_version_reset_();
+
   compute_next_();
 }
 
@@ -59,11 +64,47 @@ void Block::compute_next_ ()
 #endif
 
     int ir_post = method->refresh_id_post();
-    
-    cello::refresh(ir_post)->set_active (is_leaf());
-    
-    new_refresh_start (ir_post,CkIndex_Block::p_compute_continue());
-    
+
+    Refresh * refresh = cello::refresh(ir_post);
+
+    refresh->set_active (is_leaf());
+
+    // overlap compute_interior() with the refresh only if compute()
+    // is known to be applied this cycle
+
+    id_refresh_interior_ =
+      (method->overlap_refresh() && method->schedule() == NULL) ?
+      ir_post : -1;
+
+    if (cello::config()->mesh_refresh_skip_current && refresh->is_active()) {
+
+      // omit fields whose ghost zones are already current
+
+      Refresh refresh_plan = *refresh;
+
+      if (refresh_plan_(refresh_plan)) {
+
+        new_refresh_start
+          (ir_post,CkIndex_Block::p_compute_continue(),&refresh_plan);
+
+      } else {
+
+        // skip refresh entirely; since the same Methods are applied
+        // to all Blocks, neighbors skip it as well so no exit
+        // synchronization is needed
+
+        update_boundary_();
+        compute_interior_(ir_post);
+        CkCallback (refresh->callback(),
+                    CkArrayIndexIndex(index_),thisProxy).send(NULL);
+      }
+
+    } else {
+
+      new_refresh_start (ir_post,CkIndex_Block::p_compute_continue());
+
+    }
+
   } else {
 
     compute_end_();
@@ -105,7 +146,24 @@ void Block::compute_continue_ ()
 #endif
     // Apply the method to the Block
 
+    field_version_update_(method);
+
+    Simulation * simulation = cello::simulation();
+    const int region = simulation->perf_region_method(index_method_);
+    simulation->performance()->enter_region(region);
+
+    const double time_start = CmiWallTimer();
+
     method->compute (this);
+
+    simulation->performance()->exit_region(region);
+
+    // accumulate Method time for load balancing cost model
+
+    if (method_time_.size() <= size_t(index_method_)) {
+      method_time_.resize(index_method_+1,0.0);
+    }
+    method_time_[index_method_] += CmiWallTimer() - time_start;
     
     performance_stop_(perf_compute,__FILE__,__LINE__);
 
@@ -119,6 +177,111 @@ void Block::compute_continue_ ()
 
 //----------------------------------------------------------------------
 
+void Block::compute_interior_(int id_refresh)
+{
+  if (id_refresh_interior_ != id_refresh) return;
+
+  id_refresh_interior_ = -1;
+
+  Simulation * simulation = cello::simulation();
+  const int region = simulation->perf_region_method(index_method_);
+  simulation->performance()->enter_region(region);
+
+  const double time_start = CmiWallTimer();
+
+  method()->compute_interior (this);
+
+  simulation->performance()->exit_region(region);
+
+  // accumulate Method time for load balancing cost model
+
+  if (method_time_.size() <= size_t(index_method_)) {
+    method_time_.resize(index_method_+1,0.0);
+  }
+  method_time_[index_method_] += CmiWallTimer() - time_start;
+}
+
+//----------------------------------------------------------------------
+
+void Block::field_version_reset_()
+{
+  const int num_fields = cello::field_descr()->num_fields();
+  field_version_.assign(num_fields,1);
+  field_version_ghost_.assign(num_fields,0);
+}
+
+//----------------------------------------------------------------------
+
+void Block::field_version_update_(Method * method)
+{
+  const int num_fields = field_version_.size();
+  for (int i_f=0; i_f<num_fields; i_f++) {
+    if (method->modifies_field(i_f)) ++field_version_[i_f];
+  }
+}
+
+//----------------------------------------------------------------------
+
+bool Block::refresh_plan_(Refresh & refresh)
+{
+  // only refreshes with all leaf neighbor faces fill all ghost zones
+  // (FieldFace ignores the Refresh ghost depth)
+
+  if (refresh.neighbor_type() != neighbor_leaf ||
+      refresh.min_face_rank() != 0 ||
+      ! refresh.any_fields()) return true;
+
+  const int num_fields = cello::field_descr()->num_fields();
+
+  if (int(field_version_.size()) != num_fields) field_version_reset_();
+
+  std::vector<int> list_src, list_dst;
+
+  if (refresh.all_fields()) {
+    for (int i_f=0; i_f<num_fields; i_f++) {
+      list_src.push_back(i_f);
+      list_dst.push_back(i_f);
+    }
+  } else {
+    list_src = refresh.field_list_src();
+    list_dst = refresh.field_list_dst();
+  }
+
+  // keep fields copied to themselves only if they were modified since
+  // last refreshed; always keep distinct source and destination
+  // fields, which may accumulate values
+
+  std::vector<int> plan_src, plan_dst;
+  int num_skipped = 0;
+  for (size_t i=0; i<list_src.size(); i++) {
+    const int i_src = list_src[i];
+    const int i_dst = list_dst[i];
+    if (i_src != i_dst) {
+      plan_src.push_back(i_src);
+      plan_dst.push_back(i_dst);
+    } else if (field_version_ghost_[i_src] != field_version_[i_src]) {
+      plan_src.push_back(i_src);
+      plan_dst.push_back(i_dst);
+      // ghost zones will be current after this refresh
+      field_version_ghost_[i_src] = field_version_[i_src];
+    } else {
+      ++num_skipped;
+    }
+  }
+
+  if (num_skipped == 0) return true;
+
+  refresh.set_field_list_src_dst (plan_src,plan_dst);
+
+  const bool skipped = ! refresh.any_data();
+
+  cello::simulation()->new_refresh_skip_stats (num_skipped,skipped);
+
+  return ! skipped;
+}
+
+//----------------------------------------------------------------------
+
 void Block::compute_done ()
 {
 #ifdef DEBUG_COMPUTE
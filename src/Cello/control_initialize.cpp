@@ -50,6 +50,8 @@ void Simulation::initialize() throw()
   problem_->initialize_prolong (config_);
   problem_->initialize_restrict (config_);
 
+  initialize_performance_regions_();
+
   initialize_hierarchy_();
 
   // initialize_block_array() is called in charm_initialize
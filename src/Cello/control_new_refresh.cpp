@@ -37,10 +37,12 @@
 
 //----------------------------------------------------------------------
 
-void Block::new_refresh_start (int id_refresh, int callback)
+void Block::new_refresh_start
+(int id_refresh, int callback, Refresh * refresh_plan)
 {
   CHECK_ID(id_refresh);
-  Refresh * refresh = cello::refresh(id_refresh);
+  Refresh * refresh =
+    refresh_plan ? refresh_plan : cello::refresh(id_refresh);
   Sync * sync = sync_(id_refresh);
 #ifdef DEBUG_NEW_REFRESH
   refresh->print();
@@ -95,10 +97,17 @@ void Block::new_refresh_start (int id_refresh, int callback)
 
     TRACE_SYNC("A start");
 
+    // update cells independent of ghost zones while messages are in
+    // flight
+
+    compute_interior_(id_refresh);
+
     new_refresh_wait(id_refresh,callback);
 
   } else {
 
+    compute_interior_(id_refresh);
+
     new_refresh_exit(*refresh);
 
   }
@@ -205,9 +214,15 @@ void Block::new_refresh_check_done (int id_refresh)
 
 void Block::p_new_refresh_recv (MsgRefresh * msg)
 {
+  TRACER_ENTRY("Block::p_new_refresh_recv");
 
   const int id_refresh = msg->id_refresh();
   CHECK_ID(id_refresh);
+
+  Tracer * tracer = Tracer::instance();
+  if (tracer->is_active()) {
+    tracer->instant(tracer->name_id("refresh_recv"),id_refresh);
+  }
   TRACE_NEW_REFRESH(this,cello::refresh(id_refresh),"recv");
 
   Sync * sync = sync_(id_refresh);
@@ -237,6 +252,26 @@ void Block::p_new_refresh_recv (MsgRefresh * msg)
 
 //----------------------------------------------------------------------
 
+void Block::p_new_refresh_copy_done (int id_refresh)
+{
+  CHECK_ID(id_refresh);
+
+  TRACE_NEW_REFRESH(this,cello::refresh(id_refresh),"copy_done");
+
+  Sync * sync = sync_(id_refresh);
+
+  // the face was copied while this Block was waiting for it, and the
+  // refresh can't finish until it is counted here, so the state is
+  // still READY
+
+  sync->advance();
+
+  // check if it's the last face received
+  new_refresh_check_done(id_refresh);
+}
+
+//----------------------------------------------------------------------
+
 void Block::new_refresh_exit (Refresh & refresh)
 {
   CHECK_ID(refresh.id());
@@ -254,6 +289,175 @@ void Block::new_refresh_exit (Refresh & refresh)
 
 //----------------------------------------------------------------------
 
+void Block::new_refresh_send_ (Index index, MsgRefresh * msg)
+{
+  Tracer * tracer = Tracer::instance();
+  if (tracer->is_active()) {
+    tracer->instant(tracer->name_id("refresh_send"),msg->id_refresh());
+  }
+
+  if (cello::config()->mesh_refresh_aggregate) {
+
+    // hold message if the neighbor is (last known to be) remote
+
+    const int ip = thisProxy.ckLocMgr()->lastKnown(CkArrayIndexIndex(index));
+
+    if (ip != CkMyPe()) {
+      cello::simulation()->new_refresh_hold (ip,index,msg);
+      return;
+    }
+  }
+
+  thisProxy[index].p_new_refresh_recv (msg);
+}
+
+//----------------------------------------------------------------------
+
+void Simulation::new_refresh_hold (int ip, Index index, MsgRefresh * msg)
+{
+  new_refresh_outbox_[ip].push_back(std::make_pair(index,msg));
+
+  // flush once all Blocks on this process that are ready to refresh
+  // have loaded their faces, i.e. when the processor next goes idle
+
+  if (new_refresh_flush_id_ < 0) {
+    new_refresh_flush_id_ = CcdCallOnCondition
+      (CcdPROCESSOR_BEGIN_IDLE,Simulation::new_refresh_flush_idle_,this);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Simulation::new_refresh_flush_idle_ (void * simulation, double time)
+{
+  Simulation * sim = (Simulation *) simulation;
+
+  sim->new_refresh_flush_id_ = -1;
+
+  sim->new_refresh_flush();
+}
+
+//----------------------------------------------------------------------
+
+void Simulation::new_refresh_flush ()
+{
+  CProxy_Block block_array = hierarchy_->block_array();
+
+  // per-message overhead in the aggregate array: index and size
+  const int size_header = 4*sizeof(int);
+
+  for (auto it_ip  = new_refresh_outbox_.begin();
+       it_ip != new_refresh_outbox_.end(); ++it_ip) {
+
+    const int ip = it_ip->first;
+    auto & msg_list = it_ip->second;
+    const int num_msg = msg_list.size();
+
+    if (num_msg == 1) {
+
+      // nothing to aggregate: send directly
+      block_array[msg_list[0].first].p_new_refresh_recv
+        (msg_list[0].second);
+
+    } else if (num_msg > 1) {
+
+      // determine aggregate array size
+
+      int n = 0;
+      for (int i=0; i<num_msg; i++) {
+        n += size_header + msg_list[i].second->data_size();
+      }
+
+      MsgRefreshAggregate * msg_aggregate = new (n) MsgRefreshAggregate;
+      msg_aggregate->num_msg = num_msg;
+      msg_aggregate->n = n;
+
+      // serialize each message after its destination index and size
+
+      union {
+        char * pc;
+        int  * pi;
+      };
+      pc = msg_aggregate->a;
+
+      for (int i=0; i<num_msg; i++) {
+        MsgRefresh * msg = msg_list[i].second;
+        msg_list[i].first.values(pi);
+        pi += 3;
+        const int size = msg->data_size();
+        (*pi++) = size;
+        pc = msg->save_data(pc);
+        delete msg;
+      }
+
+      ASSERT2("Simulation::new_refresh_flush()",
+              "aggregate buffer size mismatch %ld packed %d allocated",
+              (pc - msg_aggregate->a),n,
+              (pc - msg_aggregate->a) == n);
+
+      // statistics: one message envelope per MsgRefresh is saved, at
+      // the cost of storing each message's index and size
+
+      const long long bytes_saved =
+        (long long)(num_msg - 1)*sizeof(envelope) - num_msg*size_header;
+      new_refresh_aggregate_stats (num_msg, n, bytes_saved);
+
+      proxy_simulation[ip].p_new_refresh_recv_aggregate (msg_aggregate);
+    }
+  }
+
+  new_refresh_outbox_.clear();
+}
+
+//----------------------------------------------------------------------
+
+void Simulation::p_new_refresh_recv_aggregate (MsgRefreshAggregate * msg)
+{
+  TRACER_ENTRY("Simulation::p_new_refresh_recv_aggregate");
+
+  CProxy_Block block_array = hierarchy_->block_array();
+
+  union {
+    char * pc;
+    int  * pi;
+  };
+  pc = msg->a;
+
+  for (int i=0; i<msg->num_msg; i++) {
+
+    int v3[3] = { pi[0], pi[1], pi[2] };
+    pi += 3;
+    Index index;
+    index.set_values(v3);
+    const int size = (*pi++);
+
+    // copy serialized data into a new MsgRefresh, since it may be
+    // queued by the Block until its refresh is ready
+
+    MsgRefresh * msg_refresh = new MsgRefresh;
+    msg_refresh->load_array(pc,size);
+    pc += size;
+
+    Block * block = block_array[index].ckLocal();
+
+    if (block != nullptr) {
+      block->p_new_refresh_recv (msg_refresh);
+    } else {
+      // Block has migrated: forward message
+      block_array[index].p_new_refresh_recv (msg_refresh);
+    }
+  }
+
+  ASSERT2("Simulation::p_new_refresh_recv_aggregate()",
+          "aggregate buffer size mismatch %ld unpacked %d received",
+          (pc - msg->a),msg->n,
+          (pc - msg->a) == msg->n);
+
+  delete msg;
+}
+
+//----------------------------------------------------------------------
+
 int Block::new_refresh_load_field_faces_ (Refresh & refresh)
 {
   int count = 0;
@@ -334,14 +538,27 @@ void Block::new_refresh_load_field_face_
     index_.child(index_.level(),ic3,ic3+1,ic3+2);
   }
 
+  // ... copy directly to neighbor ghosts if local and ready
+
+  if (cello::config()->mesh_refresh_local_copy &&
+      new_refresh_copy_field_face_
+      (refresh,refresh_type,index_neighbor,if3,ic3)) return;
+
   // ... copy field ghosts to array using FieldFace object
 
   MsgRefresh * msg_refresh = new MsgRefresh;
 
   bool lg3[3] = {false,false,false};
 
+  // FieldFace must own a copy of a Refresh object not registered with
+  // the Simulation, since it may not outlive the message
+
+  const bool is_registered = (&refresh == cello::refresh(refresh.id()));
+
   FieldFace * field_face = create_face
-    (if3, ic3, lg3, refresh_type, &refresh,false);
+    (if3, ic3, lg3, refresh_type,
+     is_registered ? &refresh : new Refresh (refresh),
+     ! is_registered);
 
   DataMsg * data_msg = new DataMsg;
 #ifdef DEBUG_NEW_REFRESH
@@ -362,8 +579,58 @@ void Block::new_refresh_load_field_face_
   msg_refresh->set_data_msg (data_msg);
 
   TRACE_NEW_REFRESH(this,cello::refresh(id_refresh),"send");
-  thisProxy[index_neighbor].p_new_refresh_recv (msg_refresh);
+  new_refresh_send_ (index_neighbor,msg_refresh);
+
+}
+
+//----------------------------------------------------------------------
+
+bool Block::new_refresh_copy_field_face_
+( Refresh & refresh,
+  int refresh_type,
+  Index index_neighbor,
+  int if3[3],
+  int ic3[3])
+{
+  Block * block = thisProxy[index_neighbor].ckLocal();
+
+  // neighbor must be on this process
+
+  if (block == nullptr) return false;
+
+  const int id_refresh = refresh.id();
+  Sync * sync = block->sync_(id_refresh);
+
+  // neighbor must be waiting for data, since its sync counter stop
+  // value is not yet set while active, and any queued messages must
+  // be processed first while inactive
+
+  if (sync->state() != RefreshState::READY) return false;
+
+  // copy face data directly from this Block's fields to the neighbor's
+  // ghost zones, as DataMsg::update() would for a local message
+
+  FieldFace field_face;
+  field_face.set_refresh_type (refresh_type);
+  field_face.set_child (ic3[0],ic3[1],ic3[2]);
+  field_face.set_face (if3[0],if3[1],if3[2]);
+  field_face.set_ghost (false,false,false);
+  field_face.set_refresh (&refresh,false);
+
+  Field field_src (cello::field_descr(),data()->field_data());
+  field_face.face_to_face (field_src, block->data()->field());
+
+  cello::simulation()->new_refresh_local_copy_stats();
+
+  TRACE_NEW_REFRESH(this,cello::refresh(id_refresh),"copy");
+
+  // count the face and finish the neighbor's refresh if it was the
+  // last one in a separate message, rather than running the neighbor's
+  // refresh callback from within this Block's entry method
+
+  thisProxy[index_neighbor].p_new_refresh_copy_done (id_refresh);
 
+  return true;
 }
 
 //----------------------------------------------------------------------
@@ -502,7 +769,7 @@ void Block::new_particle_send_
       msg_refresh->set_data_msg (data_msg);
       msg_refresh->set_new_refresh_id (id_refresh);
 
-      thisProxy[index].p_new_refresh_recv (msg_refresh);
+      new_refresh_send_ (index,msg_refresh);
 
     } else if (p_data) {
 
@@ -515,7 +782,7 @@ void Block::new_particle_send_
 #endif
       msg_refresh->set_new_refresh_id (id_refresh);
 
-      thisProxy[index].p_new_refresh_recv (msg_refresh);
+      new_refresh_send_ (index,msg_refresh);
 
       // assert ParticleData object exits but has no particles
       delete p_data;
@@ -1025,6 +1292,6 @@ void Block::new_refresh_load_flux_face_
   msg_refresh->set_new_refresh_id (id_refresh);
 
   TRACE_NEW_REFRESH(this,cello::refresh(id_refresh),"send");
-  thisProxy[index_neighbor].p_new_refresh_recv (msg_refresh);
+  new_refresh_send_ (index_neighbor,msg_refresh);
 
 }
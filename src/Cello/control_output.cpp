@@ -197,18 +197,41 @@ void Simulation::output_start(int index_output)
 {
   TRACE_OUTPUT("Simulation::output_start()");
   Output * output = problem()->output(index_output);
+
+  // Checkpoints must include all output written so far
+  if (dynamic_cast<OutputCheckpoint *>(output) != NULL) {
+    problem()->output_drain();
+  }
+
   output->init();
   output->open();
   index_output_ = index_output;
-  contribute(CkCallback (CkIndex_Simulation::r_output_barrier(NULL),thisProxy));
+
+  CkCallback callback (CkIndex_Simulation::r_output_barrier(NULL),thisProxy);
+
+  // Shared files are laid out from all processes' Block counts
+  // before any Block data are sent to the writer
+  OutputShared * output_shared = dynamic_cast<OutputShared *>(output);
+  if (output_shared != NULL) {
+    std::vector<int> layout = output_shared->layout_local(hierarchy_);
+    contribute(layout.size()*sizeof(int), layout.data(),
+               CkReduction::concat, callback);
+  } else {
+    contribute(callback);
+  }
 }
 
 //----------------------------------------------------------------------
 
 void Simulation::r_output_barrier(CkReductionMsg * msg)
 {
-  delete msg;
   Output * output = problem()->output(index_output_);
+  OutputShared * output_shared = dynamic_cast<OutputShared *>(output);
+  if (output_shared != NULL) {
+    output_shared->set_layout
+      (msg->getSize()/sizeof(int), (const int *) msg->getData());
+  }
+  delete msg;
   output->write_simulation(this);
 
   //  ERROR if this is moved here from Output::write_hierarchy()
@@ -379,6 +402,37 @@ void Simulation::output_exit()
 
 //----------------------------------------------------------------------
 
+void Problem::output_drain() throw()
+{
+  TRACE_OUTPUT("Problem::output_drain()");
+  for (size_t i=0; i<output_list_.size(); i++) {
+    output_list_[i]->drain();
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Simulation::p_output_drain()
+{
+  TRACE_OUTPUT("Simulation::p_output_drain()");
+  performance_->start_region(perf_output);
+  problem()->output_drain();
+  performance_->stop_region(perf_output);
+  contribute(CkCallback (CkIndex_Simulation::r_output_drain(NULL),
+                         thisProxy[0]));
+}
+
+//----------------------------------------------------------------------
+
+void Simulation::r_output_drain(CkReductionMsg * msg)
+{
+  TRACE_OUTPUT("Simulation::r_output_drain()");
+  delete msg;
+  proxy_main.p_exit(1);
+}
+
+//----------------------------------------------------------------------
+
 void Block::p_output_end()
 {
   performance_start_(perf_output);
@@ -14,6 +14,7 @@
 ///       compute stopping
 ///       contribute( >>>>> Block::r_output() >>>>> )
 
+#include "auto_config.def"
 #include "simulation.hpp"
 #include "mesh.hpp"
 #include "control.hpp"
@@ -192,7 +193,12 @@ void Block::stopping_balance_()
 
     if (index_.is_root())
       cello::monitor()->print ("Balance","staring load balance step");
-    
+
+#if CHARM_VERSION >= 60800
+    // send Index to CelloLB for ordering Blocks along the curve
+    cello::simulation()->balance_set_index (ckGetID(),index_);
+#endif
+
     control_sync_quiescence (CkIndex_Main::p_stopping_balance());
 
   } else {
@@ -236,12 +242,75 @@ void Block::ResumeFromSync()
   if (index_.is_root()) {
     thisProxy.doneInserting();
   }
+
+  // restart cost measurement for the next load balancing step
+  std::fill(method_time_.begin(),method_time_.end(),0.0);
+  solver_time_ = 0.0;
+
   stopping_exit_();
 
 }
 
 //----------------------------------------------------------------------
 
+void Block::UserSetLBLoad()
+{
+  setObjTime (cost());
+}
+
+//----------------------------------------------------------------------
+
+void Block::solver_time_start()
+{
+  if (index_solver_.empty()) {
+    solver_obj_time_start_ = getObjTime();
+    solver_method_time_start_ = 0.0;
+    for (size_t i=0; i<method_time_.size(); i++) {
+      solver_method_time_start_ += method_time_[i];
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Block::solver_time_stop()
+{
+  if (index_solver_.empty()) {
+
+    // Solvers span many entry methods, so charge the time Charm++
+    // measured for all of the Block's entry methods during the solve,
+    // less Method compute() time already in method_time_
+
+    double method_time = 0.0;
+    for (size_t i=0; i<method_time_.size(); i++) {
+      method_time += method_time_[i];
+    }
+    const double time = (getObjTime() - solver_obj_time_start_)
+      -                 (method_time - solver_method_time_start_);
+    solver_time_ += std::max(time,0.0);
+  }
+}
+
+//----------------------------------------------------------------------
+
+double Block::cost() const
+{
+  double cost = 0.0;
+  for (size_t i=0; i<method_time_.size(); i++) {
+    cost += method_time_[i];
+  }
+  cost += solver_time_;
+
+  const int64_t np = data_->particle_data()->num_particles
+    (cello::particle_descr());
+
+  cost += cello::config()->balance_cost_particle * np;
+
+  return cost;
+}
+
+//----------------------------------------------------------------------
+
 void Block::exit_()
 {
 
@@ -272,6 +341,7 @@ void Block::exit_()
     }
   }
   if (index_.is_root()) {
-    proxy_main.p_exit(1);
+    // write any staged output before exiting
+    proxy_simulation.p_output_drain();
   }
 }
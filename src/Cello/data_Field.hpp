@@ -193,6 +193,12 @@ public: // interface
   int num_history () const
   { return field_descr_->num_history(); }
 
+  /// Return whether old values of the given field are stored
+  bool has_history (int id_field) const
+  { return field_descr_->has_history(id_field); }
+  bool has_history (std::string name) const
+  { return field_descr_->has_history(field_id(name)); }
+
   /// Copy "current" fields to history = 1 fields (saving time), and push
   /// back older generations up to num_history()
   void save_history (double time)
@@ -45,7 +45,7 @@ FieldData::~FieldData() throw()
 {  
   deallocate_permanent();
   for (size_t i=0; i<array_temporary_.size(); i++) {
-    delete [] array_temporary_[i];
+    release_temporary_(array_temporary_[i],temporary_size_[i]);
     array_temporary_[i] = NULL;
     temporary_size_[i] = 0;
   }
@@ -71,7 +71,7 @@ void FieldData::pup(PUP::er &p)
     int n = temporary_size_[i];
     if (n > 0) {
       if (p.isUnpacking()) {
-	array_temporary_[i] = new char[n];
+	array_temporary_[i] = acquire_temporary_(n);
       }
       PUParray(p,array_temporary_[i],n);
     }
@@ -367,7 +367,9 @@ void FieldData::allocate_permanent
   for (int ih=0; ih<nh; ih++) {
     for (int ip=0; ip<np; ip++) {
       int i = ip + np*ih;
-      allocate_temporary (field_descr,history_id_[i]);
+      if (history_id_[i] >= 0) {
+        allocate_temporary (field_descr,history_id_[i]);
+      }
     }
   }
 }
@@ -389,15 +391,18 @@ void FieldData::allocate_temporary (const FieldDescr * field_descr,
     dimensions(field_descr,id_field,&mx,&my,&mz);
     int m = mx*my*mz;
     precision_type precision = field_descr->precision(id_field);
+    int bytes = 0;
     if (precision == precision_single) {
-      array_temporary_[index_field] = (char*) new float [m];
-      temporary_size_[index_field] = m*sizeof(float);
+      bytes = m*sizeof(float);
     } else if (precision == precision_double) {
-      array_temporary_[index_field] = (char*) new double [m];
-      temporary_size_[index_field] = m*sizeof(double);
+      bytes = m*sizeof(double);
     } else if (precision == precision_quadruple) {
-      array_temporary_[index_field] = (char*) new long double [m];
-      temporary_size_[index_field] = m*sizeof(long double);
+      bytes = m*sizeof(long double);
+    }
+    if (bytes > 0) {
+      // borrow Block-sized storage from the per-process buffer pool
+      array_temporary_[index_field] = acquire_temporary_(bytes);
+      temporary_size_[index_field] = bytes;
     } else {
       WARNING("FieldData::allocate_temporary",
 	      "Calling allocate_temporary() on already-allocated Field");
@@ -416,15 +421,8 @@ void FieldData::deallocate_temporary (const FieldDescr * field_descr,
     array_temporary_.resize(index_field+1, 0);
     temporary_size_. resize(index_field+1, 0);
   }
-  if (array_temporary_[index_field] != 0) {
-    precision_type precision = field_descr->precision(id_field);
-    if (precision == precision_single)    
-      delete [] (float *)       array_temporary_[index_field];
-    if (precision == precision_double)    
-      delete [] (double *)      array_temporary_[index_field];
-    if (precision == precision_quadruple) 
-      delete [] (long double *) array_temporary_[index_field];
-  }
+  release_temporary_(array_temporary_[index_field],
+                     temporary_size_[index_field]);
   array_temporary_[index_field] = 0;
   temporary_size_ [index_field] = 0;
 
@@ -785,8 +783,10 @@ void FieldData::save_history (const FieldDescr * field_descr, double time)
       history_id_[ip] = history_id_save[ip];
     }
 
-    // Copy field values to newest history
+    // Copy field values to newest history, skipping fields without
+    // history (older generations are only relabeled above)
     for (int ip=0; ip<np; ip++) {
+      if (history_id_[ip] < 0) continue;
       int mx,my,mz;
       char * src = values(field_descr,ip,0);
       char * dst = values(field_descr,ip,1);
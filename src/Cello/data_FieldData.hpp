@@ -217,6 +217,15 @@ private: // functions
   /// (Re-)initialize temporary fields for history
   void set_history_ (const FieldDescr * field_descr);
 
+  /// Return storage for a temporary field, from the Memory buffer
+  /// pool if available
+  static char * acquire_temporary_ (int bytes)
+  { return Memory::acquire_buffer(bytes); }
+
+  /// Return storage from acquire_temporary_()
+  static void release_temporary_ (char * array, int bytes)
+  { Memory::release_buffer(array,bytes); }
+
   /// Allocate (more) units_scaling_ array values
   void units_allocate_ (int n)
   {
@@ -24,7 +24,8 @@ FieldDescr::FieldDescr () throw ()
     ghost_depth_(),
     conserved_(),
     history_(0),
-    history_id_()
+    history_id_(),
+    history_list_()
 {
   for (int i=0; i<3; i++) {
     ghost_depth_default_[i] = 0;
@@ -143,6 +144,56 @@ void FieldDescr::ghost_depth
 
 //----------------------------------------------------------------------
 
+void FieldDescr::set_history (int history) throw()
+{
+  const int np = num_permanent();
+  const int nh = history;
+
+  // temporaries already assigned to history, reused before inserting
+  // new ones
+
+  std::vector<int> spare;
+  for (size_t i=0; i<history_id_.size(); i++) {
+    if (history_id_[i] != -1) spare.push_back(history_id_[i]);
+  }
+  size_t is = 0;
+
+  history_id_.assign(np*nh,-1);
+
+  for (int jh=0; jh<nh; jh++) {
+    for (int ip=0; ip<np; ip++) {
+
+      // no storage for fields without history
+      if (! has_history(ip)) continue;
+
+      const int ih = (is < spare.size()) ? spare[is++] : insert_temporary();
+
+      history_id_[ip + np*jh] = ih;
+
+      // set precision
+      set_precision (ih, precision(ip));
+
+      // set ghost zones
+      int gx,gy,gz;
+      ghost_depth(ip,&gx,&gy,&gz);
+      set_ghost_depth(ih,gx,gy,gz);
+
+      // set centering
+      int cx,cy,cz;
+      centering(ip,&cx,&cy,&cz);
+      set_centering(ih,cx,cy,cz);
+    }
+  }
+
+  // keep unused temporaries for a later call
+
+  history_id_.insert(history_id_.end(),spare.begin()+is,spare.end());
+
+  history_ = history;
+}
+
+//----------------------------------------------------------------------
+
 int FieldDescr::insert_permanent(const std::string & field_name) throw()
 {
 
@@ -320,6 +371,7 @@ void FieldDescr::copy_(const FieldDescr & field_descr) throw()
   for (size_t i=0; i<field_descr.history_id_.size(); i++) {
     history_id_[i] = field_descr.history_id_[i];
   }
+  history_list_ = field_descr.history_list_;
   
 }
 
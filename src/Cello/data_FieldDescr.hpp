@@ -77,6 +77,7 @@ public: // functions
     p | conserved_;
     p | history_;
     p | history_id_;
+    p | history_list_;
   }
 
   /// Set alignment
@@ -124,53 +125,55 @@ public: // functions
   // History
   //----------------------------------------------------------------------
 
-  /// Set the history depth for storing old field values
-  void set_history (int history) throw()
-  {
-    const int np = num_permanent();
-    const int nh = history;
-
-    if (history > history_) {
-      history_id_.resize(np*nh);
-      for (int ih=0; ih<nh; ih++) {
-	for (int ip=0; ip<np; ip++) {
-
-	  int i = ip + np*ih;
-
-	  const int ih = insert_temporary();
-	
-	  history_id_[i] = ih;
-
-	  // set precision
-	  set_precision (ih, precision(ip));
-
-	  // set ghost zones
-	  int gx,gy,gz;
-	  ghost_depth(ip,&gx,&gy,&gz);
-	  set_ghost_depth(ih,gx,gy,gz);
-
-	  // set centering
-	  int cx,cy,cz;
-	  centering(ip,&cx,&cy,&cz);
-	  set_centering(ih,cx,cy,cz);
-	}
-      }
-    }
-    history_ = history;
-  }
+  /// Set the history depth for storing old field values, assigning
+  /// temporary fields to each permanent field with history.  Existing
+  /// history temporaries are reused, and new ones inserted only if
+  /// more are needed
+  void set_history (int history) throw();
 
+  /// Rebuild history temporaries after fields or the history list
+  /// change
   void reset_history(int history) throw()
-  {
-    history_ = 0;
-    set_history(history);
-  }
+  { set_history(history); }
 
   /// Return the history depth for storing old field values
   int num_history () const throw()
   { return history_; }
 
+  /// Set the names of fields to store old values of; if empty (the
+  /// default) history is stored for all permanent fields.  Takes
+  /// effect at the next set_history() or reset_history()
+  void set_history_list (const std::vector<std::string> & history_list)
+    throw()
+  { history_list_ = history_list; }
+
+  /// Store old values of the given field in addition to those in the
+  /// history list (no effect if history is stored for all fields).
+  /// Returns true iff the list changed, in which case
+  /// reset_history() must be called
+  bool add_history_field (const std::string & name_field) throw()
+  {
+    if (! history_list_.empty() &&
+        std::find(history_list_.begin(), history_list_.end(), name_field)
+        == history_list_.end()) {
+      history_list_.push_back(name_field);
+      return true;
+    }
+    return false;
+  }
+
+  /// Return whether old values of the given field are stored
+  bool has_history (int id_field) const throw()
+  {
+    return is_permanent(id_field) &&
+      (history_list_.empty() ||
+       std::find(history_list_.begin(), history_list_.end(), name_[id_field])
+       != history_list_.end());
+  }
+
   /// Return the temporary field id for ih'th generation of permanent
-  /// field ip (0 is current, 1 first generation, etc.)
+  /// field ip (0 is current, 1 first generation, etc.), or -1 if the
+  /// field has no history
   int history_id (int ip, int ih) const throw()
   {
     int np = num_permanent();
@@ -299,7 +302,12 @@ private: // attributes
   /// Number of generations of history to save
   int history_;
 
-  /// Temporary fields used for history.  Non-permuted.
+  /// Names of fields with history, or empty if all permanent fields
+  std::vector<std::string> history_list_;
+
+  /// Temporary fields used for history.  Non-permuted.  Entries past
+  /// the current num_permanent()*history_ are spare temporaries kept
+  /// for reuse
   std::vector<int> history_id_;
 
 };
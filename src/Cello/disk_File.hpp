@@ -96,6 +96,10 @@ public: // virtual functions
   /// Close the opened dataset
   virtual void data_close () throw() = 0;
 
+  /// Return the byte offset in the file of the opened dataset, or -1
+  /// if it is not stored contiguously
+  virtual long long data_offset () throw() = 0;
+
   /// Read a metadata item associated with the opened dataset
   virtual void data_read_meta
   ( void * buffer, std::string name,  int * s_type,
@@ -37,7 +37,8 @@ FileHdf5::FileHdf5 (std::string path, std::string name) throw()
     data_rank_(0),
     data_prop_(H5P_DEFAULT),
     is_data_open_(false),
-    compress_level_(0)
+    compress_level_(0),
+    chunk_rank_(0)
 {
   for (int i=0; i<MAX_DATA_RANK; i++) {
     data_dims_[i] = 0;
@@ -393,6 +394,17 @@ void FileHdf5::data_close() throw()
 
 //----------------------------------------------------------------------
 
+long long FileHdf5::data_offset() throw()
+{
+  if (! is_data_open_) return -1;
+
+  haddr_t offset = H5Dget_offset (data_id_);
+
+  return (offset == HADDR_UNDEF) ? -1 : (long long)(offset);
+}
+
+//----------------------------------------------------------------------
+
 void FileHdf5::file_read_meta
   ( void * buffer, std::string name,  int * type,
     int * n1, int * n2, int * n3, int * n4) throw()
@@ -754,17 +766,35 @@ void FileHdf5::set_compress (int level) throw ()
 {
   compress_level_ = level; 
   if (compress_level_ != 0) {
-    WARNING("FileHdf5::set_compress",
-	    "Hard-coded for 2D data with chunk size [10,10]");
-    int rank = 2;
-    hsize_t chunk_size[MAX_DATA_RANK];
-    chunk_size[0]=10;
-    chunk_size[1]=10;
-    H5Pset_chunk(data_prop_,rank,chunk_size);
+    if (chunk_rank_ == 0) {
+      WARNING("FileHdf5::set_compress",
+	      "Hard-coded for 2D data with chunk size [10,10]");
+      set_chunk (10,10);
+    }
     H5Pset_deflate(data_prop_,compress_level_);
   }
 }
 
+//----------------------------------------------------------------------
+
+void FileHdf5::set_chunk (int m1, int m2, int m3, int m4) throw ()
+{
+  // Rank as in space_create_()
+
+  int rank = 4;
+
+  if (m4 == 0 || m4 == 1) -- rank;
+  if (m3 == 0 || m3 == 1) -- rank;
+  if (m2 == 0 || m2 == 1) -- rank;
+
+  hsize_t chunk_size[MAX_DATA_RANK] = { hsize_t(m1), hsize_t(m2),
+                                        hsize_t(m3), hsize_t(m4) };
+
+  H5Pset_chunk(data_prop_,rank,chunk_size);
+
+  chunk_rank_ = rank;
+}
+
 //======================================================================
 
 void FileHdf5::write_meta_
@@ -50,6 +50,7 @@ public: // interface
     p | data_prop_;
     p | is_data_open_;
     p | compress_level_;
+    p | chunk_rank_;
   }
 
 public: // virtual functions
@@ -109,6 +110,10 @@ public: // virtual functions
   /// Close the opened dataset
   virtual void data_close () throw();
 
+  /// Return the byte offset in the file of the opened dataset, or -1
+  /// if it is not stored contiguously
+  virtual long long data_offset () throw();
+
   /// Read a metadata item associated with the opened dataset
   virtual void data_read_meta
   ( void * buffer, std::string name,  int * s_type,
@@ -165,6 +170,10 @@ public: // functions
   /// Set the compression level
   void set_compress (int level) throw ();
 
+  /// Set the chunk size of subsequently created datasets, using the
+  /// same axis ordering as data_create()
+  void set_chunk (int m1, int m2=0, int m3=0, int m4=0) throw ();
+
   /// Return the compression level
   int compress () throw () {return compress_level_; }
 
@@ -284,6 +293,9 @@ private: // attributes
   /// Compression level
   int compress_level_;
 
+  /// Rank of the chunk size set by set_chunk(), or 0 if none
+  int chunk_rank_;
+
 };
 
 #endif /* DISK_FILE_HDF5_HPP */
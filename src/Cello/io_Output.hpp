@@ -174,6 +174,10 @@ public: // virtual functions
   virtual void finalize () throw ()
   { count_ ++; }
 
+  /// Complete any output deferred past close(), e.g. staged data
+  virtual void drain () throw ()
+  { }
+
   /// Write Simulation data to disk
   virtual void write_simulation ( const Simulation * simulation ) throw()
   {
@@ -21,7 +21,18 @@ OutputData::OutputData
  Config * config
 ) throw ()
   : Output(index,factory),
-    text_block_count_(0)
+    is_text_open_(false),
+    text_block_list_(),
+    is_block_index_(config->output_block_index[index_]),
+    block_index_(),
+    block_index_offset_(-1),
+    is_async_(config->output_async[index_]),
+    async_staging_bytes_
+    (int64_t(config->output_async_staging_mb[index_]*1024*1024)),
+    stages_(),
+    drain_id_(-1),
+    time_hidden_(0.0),
+    time_exposed_(0.0)
 {
   // Set process stride, with default = 1
 
@@ -40,6 +51,11 @@ OutputData::OutputData
   stride = config->output_stride_wait[index_];
   stride_wait_ = (stride == 0) ? 1 : stride;
 
+  // Staging copies do not touch the file system, so there is no
+  // reason for processes to take turns
+
+  if (is_async_) stride_wait_ = 1;
+
 }
 
 //----------------------------------------------------------------------
@@ -47,6 +63,11 @@ OutputData::OutputData
 OutputData::~OutputData() throw()
 {
   close();
+  drain();
+  if (drain_id_ >= 0) {
+    CcdCancelCallOnCondition(CcdPROCESSOR_STILL_IDLE,drain_id_);
+    drain_id_ = -1;
+  }
 }
 
 //----------------------------------------------------------------------
@@ -60,7 +81,11 @@ void OutputData::pup (PUP::er &p)
 
   Output::pup(p);
 
-  p | text_block_count_;
+  p | is_block_index_;
+  p | is_async_;
+  p | async_staging_bytes_;
+  // NOTE: stages_ not pup'ed: staged data are drained before
+  // checkpoints and load balancing does not migrate Simulation
 }
 
 //======================================================================
@@ -74,6 +99,28 @@ void OutputData::open () throw()
 
   std::string dir = directory();
 
+  // Start accumulating block_list and block_index entries
+
+  is_text_open_ = true;
+  text_block_list_.clear();
+  block_index_.clear();
+
+  if (is_async_) {
+
+    // Keep at most two stages: if the previous two outputs are still
+    // being written, finish the oldest before starting a new one
+
+    drain_ (stages_.size() < 2 ? 0 : stages_.size() - 1);
+
+    Monitor::instance()->print 
+      ("Output","staging data file %s",
+       (dir + "/" + file_name).c_str());
+
+    stages_.push_back(new OutputStage (dir,file_name));
+
+    return;
+  }
+
   Monitor::instance()->print 
     ("Output","writing data file %s",
      (dir + "/" + file_name).c_str());
@@ -92,6 +139,16 @@ void OutputData::close () throw()
 #endif    
   if (file_) file_->file_close();
   delete file_;  file_ = 0;
+
+  if (is_text_open_) {
+    is_text_open_ = false;
+    write_text_files_();
+  }
+
+  if (is_async_ && ! stages_.empty()) {
+    stages_.back()->set_complete();
+    schedule_drain_();
+  }
 }
 
 //----------------------------------------------------------------------
@@ -113,7 +170,11 @@ void OutputData::write_hierarchy ( const Hierarchy  * hierarchy ) throw()
 #endif    
   IoHierarchy io_hierarchy(hierarchy);
 
-  write_meta (&io_hierarchy);
+  if (is_async_) {
+    stages_.back()->add_file_meta(&io_hierarchy);
+  } else {
+    write_meta (&io_hierarchy);
+  }
 
   Output::write_hierarchy(hierarchy);
   
@@ -127,30 +188,10 @@ void OutputData::write_block ( const  Block * block ) throw()
     CkPrintf ("%d TRACE_OUTPUT OutputData::write_block()\n",CkMyPe());
 #endif    
 
-  char file[256];
-  char dir[256];
-  char line[256];
-
-  std::string name_dir = expand_name_(&dir_name_,&dir_args_);
-
+  std::string name_dir, name_file, name_out_file;
 
-  // Write blocks text file
-  std::string name_file;
-  std::string name_out_file  = expand_name_(&file_name_,&file_args_);
+  text_file_names_(&name_dir,&name_file,&name_out_file);
 
-  if (name_dir == "") {
-    // output block list and parameters to work directory
-    name_dir  = ".";
-    // strip extension, use this for name
-    name_file = name_out_file.substr(0, name_out_file.rfind("."));
-  } else {
-    // output block list and parameters to subdirectory
-    name_file = name_dir;
-  }
-
-  const int num_blocks = cello::hierarchy()->num_blocks();
-  int count = 0;
-    
   // Write DIR.parameters file
 
   if (block->index().is_root()) {
@@ -160,39 +201,31 @@ void OutputData::write_block ( const  Block * block ) throw()
     g_parameters.write(libconfig_file_name.c_str(),param_write_libconfig);
   }
     
-  // Contribute to DIR.block_list file
-    
-  count = (text_block_count_ == 0) ? num_blocks : 0;
+  // Add to DIR.block_list file, written by write_text_files_()
 
-  sprintf (file,"%s.block_list",name_file.c_str());
-  sprintf (dir, "%s",           name_dir.c_str());
-  sprintf (line,"%s %s\n",      block->name().c_str(),name_out_file.c_str());
-    
-  proxy_main.p_text_file_write(strlen(dir)+1,  dir,
-			       strlen(file)+1, file,
-			       strlen(line)+1, line,
-			       count);
+  text_block_list_ += block->name() + " " + name_out_file + "\n";
 
-    
-  // Contribute to DIR.file_list file
+  block_index_offset_ = -1;
 
-  if (text_block_count_ == 0) {
-      
-    count = 0;
-    
-    sprintf (file,"%s.file_list",name_file.c_str());
-    sprintf (dir, "%s",          name_dir.c_str());
-    sprintf (line,"%s\n",        name_out_file.c_str());
-    
-    proxy_main.p_text_file_write(strlen(dir)+1,  dir,
-				 strlen(file)+1, file,
-				 strlen(line)+1, line,
-				 count);
-  }    
+  if (is_async_) {
+
+    // Copy block metadata, fields and particles to the stage
+
+    io_block()->set_block((Block *)block);
 
-  // Increment block counter
+    stages_.back()->add_group(block->name(),io_block());
 
-  text_block_count_ = (text_block_count_ + 1) % num_blocks;
+    Output::write_block(block);
+
+    if (async_staging_bytes_ > 0 &&
+        staged_bytes_() > async_staging_bytes_) {
+      drain_ (0);
+    }
+
+    if (is_block_index_) add_block_index_(block,name_out_file);
+
+    return;
+  }
 
   // Create file group for block
 
@@ -214,6 +247,8 @@ void OutputData::write_block ( const  Block * block ) throw()
 
   file_->group_close();
 
+  if (is_block_index_) add_block_index_(block,name_out_file);
+
 }
 
 //----------------------------------------------------------------------
@@ -243,6 +278,11 @@ void OutputData::write_field_data
 
     // Write ith FieldData data
 
+    if (is_async_) {
+      stages_.back()->add_data(name,type,nxd,nyd,nzd,nx,ny,nz,buffer);
+      continue;
+    }
+
     file_->mem_create(nx,ny,nz,nx,ny,nz,0,0,0);
     if (nzd > 1) {
       file_->data_create(name.c_str(),type,nzd,nyd,nxd,1,nz,ny,nx,1);
@@ -252,6 +292,9 @@ void OutputData::write_field_data
       file_->data_create(name.c_str(),type,nxd,  1,  1,1,nx,  1,1,1);
     }
     file_->data_write(buffer);
+    if (block_index_offset_ < 0) {
+      block_index_offset_ = file_->data_offset();
+    }
     file_->data_close();
   }
 
@@ -291,6 +334,16 @@ void OutputData::write_particle_data
     
     const int type = particle.attribute_type(it,ia);
 
+    if (is_async_) {
+      // concatenate batches into a single staged array
+      stages_.back()->add_data(name,type,0,1,1,0,1,1,nullptr);
+      for (int ib=0; ib<nb; ib++) {
+        stages_.back()->append_data
+          (particle.num_particles(it,ib),particle.attribute_array(it,ia,ib));
+      }
+      continue;
+    }
+
     // create the disk array
     file_->data_create(name.c_str(),type,np,1,1,1,np,1,1,1);
     
@@ -335,3 +388,216 @@ void OutputData::write_particle_data
 }
 
 //======================================================================
+
+void OutputData::drain () throw()
+{
+  drain_ (stages_.size());
+}
+
+//----------------------------------------------------------------------
+
+void OutputData::drain_ (size_t num_stages) throw()
+{
+  if (stages_.empty()) return;
+
+  // write the oldest num_stages stages, then enough of the rest to
+  // respect the staging limit
+
+  size_t num_remaining = stages_.size() - std::min(num_stages,stages_.size());
+
+  while (stages_.size() > num_remaining) {
+    if (! drain_next_(false)) break;
+  }
+  while (async_staging_bytes_ > 0 &&
+         staged_bytes_() > async_staging_bytes_) {
+    if (! drain_next_(false)) break;
+  }
+}
+
+//----------------------------------------------------------------------
+
+bool OutputData::drain_next_ (bool is_hidden) throw()
+{
+  if (stages_.empty()) return false;
+
+  OutputStage * stage = stages_.front();
+
+  Timer timer;
+  timer.start();
+  const bool wrote = stage->write_next();
+  const double time = timer.stop();
+
+  stage->add_time (time,is_hidden);
+  (is_hidden ? time_hidden_ : time_exposed_) += time;
+
+  if (stage->is_done()) {
+    Monitor::instance()->print
+      ("Output","wrote data file %s (%.3f s hidden %.3f s exposed)",
+       stage->file_path().c_str(),
+       stage->time_hidden(), stage->time_exposed());
+    delete stage;
+    stages_.pop_front();
+    return true;
+  }
+
+  return wrote;
+}
+
+//----------------------------------------------------------------------
+
+void OutputData::schedule_drain_ () throw()
+{
+  if (drain_id_ < 0 && ! stages_.empty() && stages_.front()->is_complete()) {
+    drain_id_ = CcdCallOnCondition
+      (CcdPROCESSOR_STILL_IDLE,OutputData::drain_idle_,this);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void OutputData::drain_idle_ (void * output_data, double time)
+{
+  OutputData * output = (OutputData *) output_data;
+
+  output->drain_id_ = -1;
+
+  // write one Block group per call so pending messages are not
+  // delayed by more than a single group write
+
+  output->drain_next_(true);
+
+  output->schedule_drain_();
+}
+
+//----------------------------------------------------------------------
+
+int64_t OutputData::staged_bytes_ () const throw()
+{
+  int64_t bytes = 0;
+  for (size_t i=0; i<stages_.size(); i++) {
+    bytes += stages_[i]->bytes();
+  }
+  return bytes;
+}
+
+//----------------------------------------------------------------------
+
+void OutputData::text_file_names_
+(std::string * name_dir,
+ std::string * name_file,
+ std::string * name_out_file) const throw()
+{
+  (*name_dir)      = expand_name_(&dir_name_,&dir_args_);
+  (*name_out_file) = expand_name_(&file_name_,&file_args_);
+
+  if ((*name_dir) == "") {
+    // output block list and parameters to work directory
+    (*name_dir)  = ".";
+    // strip extension, use this for name
+    (*name_file) = name_out_file->substr(0, name_out_file->rfind("."));
+  } else {
+    // output block list and parameters to subdirectory
+    (*name_file) = (*name_dir);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void OutputData::add_block_index_
+(const Block * block, const std::string & name_out_file) throw()
+{
+  // see write_text_files_() for the record layout
+
+  int level = block->level();
+  double lower[3] = {0.0, 0.0, 0.0};
+  double upper[3] = {0.0, 0.0, 0.0};
+  block->lower(&lower[0],&lower[1],&lower[2]);
+  block->upper(&upper[0],&upper[1],&upper[2]);
+  long long offset = block_index_offset_;
+  const std::string & name = block->name();
+  int name_len = name.size();
+  int file_len = name_out_file.size();
+
+  append_bytes_ (&block_index_, &level,   sizeof(level));
+  append_bytes_ (&block_index_, lower,    sizeof(lower));
+  append_bytes_ (&block_index_, upper,    sizeof(upper));
+  append_bytes_ (&block_index_, &offset,  sizeof(offset));
+  append_bytes_ (&block_index_, &name_len,sizeof(name_len));
+  append_bytes_ (&block_index_, name.data(),name_len);
+  append_bytes_ (&block_index_, &file_len,sizeof(file_len));
+  append_bytes_ (&block_index_, name_out_file.data(),file_len);
+}
+
+//----------------------------------------------------------------------
+
+void OutputData::write_text_files_ () throw()
+{
+  // Pack this process's lines for DIR.block_list, DIR.file_list, and
+  // (optionally) DIR.block_index into one buffer, and gather all
+  // processes' buffers to Main with a single concat reduction.
+  //
+  // Each entry is "int n; char path[n]; int m; char data[m]", which
+  // Main::r_text_file_write() appends to the file path.
+  //
+  // DIR.block_index is a sequence of binary records, one per Block, in
+  // native byte order:
+  //
+  //    int       level
+  //    double    lower[3]
+  //    double    upper[3]
+  //    long long offset      HDF5 file offset of the Block's first
+  //                          field dataset, or -1 if not known
+  //    int       name_len
+  //    char      name[name_len]
+  //    int       file_len
+  //    char      file[file_len]
+
+  std::string name_dir, name_file, name_out_file;
+
+  text_file_names_(&name_dir,&name_file,&name_out_file);
+
+  const std::string path = name_dir + "/" + name_file;
+
+  std::vector<char> buffer;
+
+  std::string file_list =
+    text_block_list_.empty() ? "" : name_out_file + "\n";
+
+  append_entry_ (&buffer, path + ".block_list",
+                 text_block_list_.data(), text_block_list_.size());
+  append_entry_ (&buffer, path + ".file_list",
+                 file_list.data(), file_list.size());
+  if (is_block_index_) {
+    append_entry_ (&buffer, path + ".block_index",
+                   block_index_.data(), block_index_.size());
+  }
+
+  text_block_list_.clear();
+  block_index_.clear();
+
+  CkCallback callback (CkIndex_Main::r_text_file_write(NULL), proxy_main);
+  cello::simulation()->contribute
+    (buffer.size(), buffer.data(), CkReduction::concat, callback);
+}
+
+//----------------------------------------------------------------------
+
+void OutputData::append_entry_
+(std::vector<char> * buffer, const std::string & path,
+ const void * data, int n) throw()
+{
+  int np = path.size();
+  append_bytes_ (buffer, &np, sizeof(np));
+  append_bytes_ (buffer, path.data(), np);
+  append_bytes_ (buffer, &n, sizeof(n));
+  append_bytes_ (buffer, data, n);
+}
+
+//----------------------------------------------------------------------
+
+void OutputData::append_bytes_
+(std::vector<char> * buffer, const void * data, int n) throw()
+{
+  const char * c = (const char *) data;
+  buffer->insert(buffer->end(), c, c + n);
+}
@@ -21,7 +21,19 @@ class OutputData : public Output {
 public: // functions
 
   /// Empty constructor for Charm++ pup()
-  OutputData() throw() : text_block_count_(0) {}
+  OutputData() throw()
+    : is_text_open_(false),
+      text_block_list_(),
+      is_block_index_(false),
+      block_index_(),
+      block_index_offset_(-1),
+      is_async_(false),
+      async_staging_bytes_(0),
+      stages_(),
+      drain_id_(-1),
+      time_hidden_(0.0),
+      time_exposed_(0.0)
+  {}
 
   /// Create an uninitialized OutputData object
   OutputData(int index,
@@ -37,7 +49,17 @@ public: // functions
   /// Charm++ PUP::able migration constructor
   OutputData (CkMigrateMessage *m)
     : Output (m),
-      text_block_count_(0)
+      is_text_open_(false),
+      text_block_list_(),
+      is_block_index_(false),
+      block_index_(),
+      block_index_offset_(-1),
+      is_async_(false),
+      async_staging_bytes_(0),
+      stages_(),
+      drain_id_(-1),
+      time_hidden_(0.0),
+      time_exposed_(0.0)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -75,11 +97,88 @@ public: // virtual functions
   ( const ParticleData * particle_data,
     int index_particle) throw();
 
-protected:
+  /// Write all staged data to disk
+  virtual void drain () throw();
 
-  /// Count of number of Blocks sent from local process for text file
-  /// output
-  int text_block_count_;
+protected: // functions
+
+  /// Write staged data to disk until the oldest num_stages stages are
+  /// written and the staged bytes are within the limit
+  void drain_ (size_t num_stages) throw();
+
+  /// Write one group of staged data and return whether any remains.
+  /// is_hidden is whether the write is while otherwise idle
+  bool drain_next_ (bool is_hidden) throw();
+
+  /// Request drain_idle_() be called when the processor is idle
+  void schedule_drain_ () throw();
+
+  /// Converse idle callback to write staged data
+  static void drain_idle_ (void * output_data, double time);
+
+  /// Return the number of bytes staged but not yet written
+  int64_t staged_bytes_ () const throw();
+
+  /// Return the directory, base name, and data file name used for
+  /// the block_list, file_list, and block_index files
+  void text_file_names_ (std::string * name_dir,
+                         std::string * name_file,
+                         std::string * name_out_file) const throw();
+
+  /// Add the Block's record to the block_index buffer
+  void add_block_index_ (const Block * block,
+                         const std::string & name_out_file) throw();
+
+  /// Gather this process's block_list, file_list, and block_index
+  /// entries to Main
+  void write_text_files_ () throw();
+
+  /// Append a file path and its data to the buffer sent to Main
+  static void append_entry_ (std::vector<char> * buffer,
+                             const std::string & path,
+                             const void * data, int n) throw();
+
+  /// Append n bytes to the buffer
+  static void append_bytes_ (std::vector<char> * buffer,
+                             const void * data, int n) throw();
+
+protected: // attributes
+
+  /// Whether block_list entries are being accumulated for the
+  /// current output
+  bool is_text_open_;
+
+  /// Lines of the block_list file from Blocks on this process
+  std::string text_block_list_;
+
+  /// Whether to write a binary block_index file
+  bool is_block_index_;
+
+  /// Records of the block_index file from Blocks on this process
+  std::vector<char> block_index_;
+
+  /// File offset of the first field dataset of the current Block
+  long long block_index_offset_;
+
+  /// Whether Block data are copied to a stage and written after the
+  /// output phase instead of during it
+  bool is_async_;
+
+  /// Maximum bytes of staged data before writing synchronously (0 for
+  /// no limit)
+  int64_t async_staging_bytes_;
+
+  /// Stages not yet written, oldest first
+  std::deque<OutputStage *> stages_;
+
+  /// Converse callback id of the pending idle drain, or -1 if none
+  int drain_id_;
+
+  /// Total time spent writing staged data while otherwise idle
+  double time_hidden_;
+
+  /// Total time spent writing staged data while the simulation waited
+  double time_exposed_;
 };
 
 #endif /* IO_OUTPUT_DATA_HPP */
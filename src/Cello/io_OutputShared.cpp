@@ -0,0 +1,461 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     io_OutputShared.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     Sat Oct 17 15:02:18 PDT 2026
+/// @brief    Implementation of the OutputShared class
+
+#include "cello.hpp"
+#include "main.hpp"
+#include "io.hpp"
+
+//----------------------------------------------------------------------
+
+OutputShared::OutputShared
+(
+ int index,
+ const Factory * factory,
+ Config * config,
+ int process_count
+) throw ()
+  : Output(index,factory),
+    compress_level_(config->output_compress[index]),
+    buffer_()
+{
+  // Default is a single file written by the root process
+
+  const int stride = config->output_stride_write[index_];
+  set_stride_write ((stride == 0) ? process_count : stride);
+
+  stride_wait_ = 1;
+}
+
+//----------------------------------------------------------------------
+
+void OutputShared::pup (PUP::er &p)
+{
+  TRACEPUP;
+
+  // NOTE: change this function whenever attributes change
+
+  Output::pup(p);
+
+  p | compress_level_;
+  // NOTE: remaining attributes not pup'ed: only used during the
+  // output phase
+}
+
+//----------------------------------------------------------------------
+
+std::vector<int> OutputShared::layout_local
+(Hierarchy * hierarchy) const throw()
+{
+  const int nb = hierarchy->num_blocks();
+
+  int name_len = 0;
+  for (int ib=0; ib<nb; ib++) {
+    name_len = std::max(name_len,int(hierarchy->block(ib)->name().size()));
+  }
+  return std::vector<int> { CkMyPe(), nb, name_len };
+}
+
+//----------------------------------------------------------------------
+
+void OutputShared::set_layout (int n, const int * layout) throw()
+{
+  // concatenated (process, Block count, name length) triples are in
+  // no particular order
+
+  const int np = n / 3;
+  std::vector<int> num_blocks (np,0);
+  int name_len = 1;
+  for (int i=0; i<n; i+=3) {
+    num_blocks[layout[i]] = layout[i+1];
+    name_len = std::max(name_len,layout[i+2]);
+  }
+
+  const int ip_write = process_writer();
+  const int ip_end = std::min(ip_write + stride_write(), np);
+
+  // Blocks are ordered by process, then by name within each process
+
+  block_offset_.resize(ip_end - ip_write + 1);
+  block_offset_[0] = 0;
+  for (int ip=ip_write; ip<ip_end; ip++) {
+    const int k = ip - ip_write;
+    block_offset_[k+1] = block_offset_[k] + num_blocks[ip];
+  }
+  name_len_ = name_len;
+
+  if (is_writer()) {
+
+    create_file_();
+
+    // Write Blocks whose data arrived before the layout
+
+    for (size_t i=0; i<pending_.size(); i++) {
+      write_blocks_(pending_[i].data(),pending_[i].size());
+    }
+    pending_.clear();
+  }
+}
+
+//======================================================================
+
+void OutputShared::open () throw()
+{
+  buffer_.clear();
+  pending_.clear();
+  block_offset_.clear();
+  name_len_ = 0;
+  num_blocks_written_ = 0;
+  field_shape_.clear();
+
+  // Buffer starts with the process id, so the writer can locate its
+  // Blocks in the file
+
+  const int ip = CkMyPe();
+  append_ (&ip, sizeof(ip));
+}
+
+//----------------------------------------------------------------------
+
+void OutputShared::close () throw()
+{
+  if (is_writer()) {
+
+    write_blocks_(buffer_.data(),buffer_.size());
+
+    ASSERT2 ("OutputShared::close()",
+             "Wrote %d Blocks but expected %d",
+             num_blocks_written_, block_offset_.back(),
+             (num_blocks_written_ == block_offset_.back()));
+
+    FileHdf5 * file = static_cast<FileHdf5 *>(file_);
+    file->file_close();
+    delete file;
+    file_ = NULL;
+  }
+  buffer_.clear();
+}
+
+//----------------------------------------------------------------------
+
+void OutputShared::write_block ( const Block * block ) throw()
+{
+  // Block header: name, level, and extents
+
+  const std::string & name = block->name();
+  int name_len = name.size();
+  int level = block->level();
+  double lower[3] = {0.0, 0.0, 0.0};
+  double upper[3] = {0.0, 0.0, 0.0};
+  block->lower(&lower[0],&lower[1],&lower[2]);
+  block->upper(&upper[0],&upper[1],&upper[2]);
+
+  append_ (&name_len, sizeof(name_len));
+  append_ (name.data(), name_len);
+  append_ (&level, sizeof(level));
+  append_ (lower, sizeof(lower));
+  append_ (upper, sizeof(upper));
+
+  // Field arrays, via write_field_data()
+
+  Output::write_block(block);
+}
+
+//----------------------------------------------------------------------
+
+void OutputShared::write_field_data
+( const FieldData * field_data, int index_field) throw()
+{
+  io_field_data()->set_field_data((FieldData*)field_data);
+  io_field_data()->set_field_index(index_field);
+
+  void * buffer;
+  int type;
+  int nx,ny,nz;
+
+  io_field_data()->field_array
+    (0, &buffer, NULL, &type, NULL,NULL,NULL, &nx,&ny,&nz);
+
+  append_ (&type, sizeof(type));
+  append_ (&nx,   sizeof(nx));
+  append_ (&ny,   sizeof(ny));
+  append_ (&nz,   sizeof(nz));
+  append_ (buffer, cello::type_bytes[type]*nx*ny*nz);
+}
+
+//----------------------------------------------------------------------
+
+void OutputShared::prepare_remote (int * n, char ** buffer) throw()
+{
+  (*n)      = buffer_.size();
+  (*buffer) = buffer_.data();
+}
+
+//----------------------------------------------------------------------
+
+void OutputShared::update_remote  ( int n, char * buffer) throw()
+{
+  if (block_offset_.empty()) {
+    // Data may arrive before this process receives the layout
+    pending_.push_back(std::vector<char>(buffer, buffer + n));
+  } else {
+    write_blocks_(buffer,n);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void OutputShared::cleanup_remote (int * n, char ** buffer) throw()
+{
+  buffer_.clear();
+  (*n) = 0;
+  (*buffer) = NULL;
+}
+
+//======================================================================
+
+void OutputShared::append_ (const void * data, int n) throw()
+{
+  const char * c = (const char *) data;
+  buffer_.insert(buffer_.end(), c, c + n);
+}
+
+//----------------------------------------------------------------------
+
+std::vector<std::string> OutputShared::field_names_ () const throw()
+{
+  FieldDescr * field_descr = cello::field_descr();
+
+  std::vector<std::string> field_names;
+  ItIndex * it_f = it_field_index_;
+  if (it_f) {
+    for (it_f->first(); ! it_f->done(); it_f->next()) {
+      field_names.push_back
+        ("field_" + field_descr->field_name(it_f->value()));
+    }
+  }
+  return field_names;
+}
+
+//----------------------------------------------------------------------
+
+void OutputShared::create_file_ () throw()
+{
+  const int nb = block_offset_.back();
+
+  std::string file_name = expand_name_(&file_name_,&file_args_);
+  std::string dir = directory();
+
+  Monitor::instance()->print
+    ("Output","writing shared data file %s (%d blocks)",
+     (dir + "/" + file_name).c_str(), nb);
+
+  FileHdf5 * file = new FileHdf5 (dir,file_name);
+  file_ = file;
+
+  file->file_create();
+
+  IoHierarchy io_hierarchy(cello::hierarchy());
+  write_meta (&io_hierarchy);
+
+  if (nb == 0) return;
+
+  // Block index datasets: block i is at index i of each field dataset.
+  // Created before any chunked field dataset
+
+  file->data_create("block_name",type_char,nb,name_len_);
+  file->data_close();
+  file->data_create("block_level",type_int,nb);
+  file->data_close();
+  file->data_create("block_lower",type_double,nb,3);
+  file->data_close();
+  file->data_create("block_upper",type_double,nb,3);
+  file->data_close();
+}
+
+//----------------------------------------------------------------------
+
+void OutputShared::create_fields_
+(const std::vector<int> & field_shape) throw()
+{
+  FileHdf5 * file = static_cast<FileHdf5 *>(file_);
+
+  const std::vector<std::string> field_names = field_names_();
+  const int nf = field_names.size();
+  const int nb = block_offset_.back();
+
+  // Field datasets: one chunk per Block
+
+  for (int i_f=0; i_f<nf; i_f++) {
+
+    const int type = field_shape[4*i_f];
+    const int nx   = field_shape[4*i_f+1];
+    const int ny   = field_shape[4*i_f+2];
+    const int nz   = field_shape[4*i_f+3];
+
+    // axes as in OutputData::write_field_data(), with Block first
+
+    int m2=nx, m3=1, m4=1;
+    if (nz > 1)      { m2=nz; m3=ny; m4=nx; }
+    else if (ny > 1) { m2=ny; m3=nx; }
+
+    file->set_chunk (1,m2,m3,m4);
+    if (compress_level_ != 0) file->set_compress(compress_level_);
+
+    file->data_create(field_names[i_f],type,nb,m2,m3,m4);
+    file->data_close();
+  }
+
+  field_shape_ = field_shape;
+}
+
+//----------------------------------------------------------------------
+
+void OutputShared::write_blocks_ (const char * buffer, int n) throw()
+{
+  const std::vector<std::string> field_names = field_names_();
+  const int nf = field_names.size();
+
+  // Locate each Block's data in the buffer
+
+  struct BlockRecord {
+    std::string name;
+    int level;
+    double lower[3];
+    double upper[3];
+    std::vector<const char *> field;
+  };
+
+  const char * p   = buffer;
+  const char * end = p + n;
+
+  int ip;
+  memcpy (&ip,p,sizeof(int));                      p += sizeof(int);
+
+  std::vector<BlockRecord> blocks;
+  std::vector<int> field_shape;
+
+  while (p < end) {
+
+    BlockRecord block;
+    int name_len;
+    memcpy (&name_len,p,sizeof(int));              p += sizeof(int);
+    block.name = std::string (p,name_len);         p += name_len;
+    memcpy (&block.level,p,sizeof(int));           p += sizeof(int);
+    memcpy (block.lower,p,3*sizeof(double));       p += 3*sizeof(double);
+    memcpy (block.upper,p,3*sizeof(double));       p += 3*sizeof(double);
+
+    for (int i_f=0; i_f<nf; i_f++) {
+      int shape[4];
+      memcpy (shape,p,4*sizeof(int));              p += 4*sizeof(int);
+
+      if (field_shape.size() < size_t(4*nf)) {
+        field_shape.insert(field_shape.end(),shape,shape+4);
+      }
+
+      ASSERT2 ("OutputShared::write_blocks_()",
+               "Field %s array size differs in Block %s",
+               field_names[i_f].c_str(), block.name.c_str(),
+               std::equal(shape,shape+4,&field_shape[4*i_f]));
+
+      block.field.push_back(p);
+      p += cello::type_bytes[shape[0]]*shape[1]*shape[2]*shape[3];
+    }
+    blocks.push_back(block);
+  }
+
+  // Order Blocks by name so file layout does not depend on the order
+  // Blocks were written
+
+  std::sort (blocks.begin(), blocks.end(),
+             [](const BlockRecord & a, const BlockRecord & b)
+             { return a.name < b.name; });
+
+  const int nb = block_offset_.back();
+  const int k = ip - process_writer();
+  const int ib0 = block_offset_[k];
+
+  ASSERT3 ("OutputShared::write_blocks_()",
+           "Process %d sent %d Blocks but expected %d",
+           ip, int(blocks.size()), block_offset_[k+1] - ib0,
+           (int(blocks.size()) == block_offset_[k+1] - ib0));
+
+  if (blocks.empty()) return;
+
+  if (field_shape_.empty()) create_fields_(field_shape);
+
+  ASSERT1 ("OutputShared::write_blocks_()",
+           "Field array sizes from process %d differ from other processes",
+           ip, (field_shape == field_shape_));
+
+  FileHdf5 * file = static_cast<FileHdf5 *>(file_);
+  const int nbp = blocks.size();
+  int type;
+
+  // Block index datasets
+
+  std::vector<char> name (name_len_);
+  file->mem_create(name_len_,1,1,name_len_,1,1,0,0,0);
+  file->data_open("block_name",&type);
+  for (int i=0; i<nbp; i++) {
+    std::fill (name.begin(),name.end(),'\0');
+    blocks[i].name.copy(name.data(),name_len_);
+    file->data_slice (nb,name_len_,1,1, 1,name_len_,1,1, ib0+i,0,0,0);
+    file->data_write(name.data());
+  }
+  file->data_close();
+  file->mem_close();
+
+  file->mem_create(1,1,1,1,1,1,0,0,0);
+  file->data_open("block_level",&type);
+  for (int i=0; i<nbp; i++) {
+    file->data_slice (nb,1,1,1, 1,1,1,1, ib0+i,0,0,0);
+    file->data_write(&blocks[i].level);
+  }
+  file->data_close();
+  file->mem_close();
+
+  file->mem_create(3,1,1,3,1,1,0,0,0);
+  file->data_open("block_lower",&type);
+  for (int i=0; i<nbp; i++) {
+    file->data_slice (nb,3,1,1, 1,3,1,1, ib0+i,0,0,0);
+    file->data_write(blocks[i].lower);
+  }
+  file->data_close();
+  file->data_open("block_upper",&type);
+  for (int i=0; i<nbp; i++) {
+    file->data_slice (nb,3,1,1, 1,3,1,1, ib0+i,0,0,0);
+    file->data_write(blocks[i].upper);
+  }
+  file->data_close();
+  file->mem_close();
+
+  // Field datasets
+
+  for (int i_f=0; i_f<nf; i_f++) {
+
+    const int nx = field_shape_[4*i_f+1];
+    const int ny = field_shape_[4*i_f+2];
+    const int nz = field_shape_[4*i_f+3];
+
+    int m2=nx, m3=1, m4=1;
+    if (nz > 1)      { m2=nz; m3=ny; m4=nx; }
+    else if (ny > 1) { m2=ny; m3=nx; }
+
+    file->mem_create(nx,ny,nz,nx,ny,nz,0,0,0);
+    file->data_open(field_names[i_f],&type);
+    for (int i=0; i<nbp; i++) {
+      file->data_slice (nb,m2,m3,m4,
+                        1, m2,m3,m4,
+                        ib0+i,0, 0, 0);
+      file->data_write(blocks[i].field[i_f]);
+    }
+    file->data_close();
+    file->mem_close();
+  }
+
+  num_blocks_written_ += nbp;
+}
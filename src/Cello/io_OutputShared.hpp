@@ -0,0 +1,151 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     io_OutputShared.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     Sat Oct 17 15:02:18 PDT 2026
+/// @brief    [\ref Io] Declaration of the OutputShared class
+
+#ifndef IO_OUTPUT_SHARED_HPP
+#define IO_OUTPUT_SHARED_HPP
+
+class Factory;
+class Config;
+
+class OutputShared : public Output {
+
+  /// @class    OutputShared
+  /// @ingroup  Io
+  /// @brief [\ref Io] Write Block field data from a group of processes
+  /// to a single file, with one dataset per field indexed by Block
+  ///
+  /// Block counts are reduced before any data are sent, so the writer
+  /// creates its datasets up front and writes each process's Blocks to
+  /// their hyperslabs as its message arrives, holding at most one
+  /// process's data at a time
+
+public: // functions
+
+  /// Empty constructor for Charm++ pup()
+  OutputShared() throw()
+    : compress_level_(0),
+      buffer_(),
+      pending_(),
+      block_offset_(),
+      name_len_(0),
+      num_blocks_written_(0),
+      field_shape_()
+  { }
+
+  /// Create an uninitialized OutputShared object
+  OutputShared(int index,
+               const Factory * factory,
+               Config * config,
+               int process_count) throw();
+
+  /// Charm++ PUP::able declarations
+  PUPable_decl(OutputShared);
+
+  /// Charm++ PUP::able migration constructor
+  OutputShared (CkMigrateMessage *m)
+    : Output (m),
+      compress_level_(0),
+      buffer_(),
+      pending_(),
+      block_offset_(),
+      name_len_(0),
+      num_blocks_written_(0),
+      field_shape_()
+  { }
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p);
+
+  /// Return this process's contribution to the layout reduction: its
+  /// process id, Block count, and longest Block name length.  Arrays
+  /// are reduced with concat, so traffic grows only linearly with the
+  /// number of processes
+  std::vector<int> layout_local (Hierarchy * hierarchy) const throw();
+
+  /// Set the file layout from the n concatenated layout_local() values,
+  /// and create the file and Block datasets if writer
+  void set_layout (int n, const int * layout) throw();
+
+public: // virtual functions
+
+  /// Clear Block data for the next output
+  virtual void open () throw();
+
+  /// Write gathered Block data to the file if writer
+  virtual void close () throw();
+
+  /// Copy Block data to the buffer
+  virtual void write_block ( const Block * block ) throw();
+
+  /// Copy field data to the buffer
+  virtual void write_field_data
+  ( const FieldData * field_data, int index_field) throw();
+
+  /// Particle data are not written
+  virtual void write_particle_data
+  ( const ParticleData * particle_data, int index_particle) throw()
+  { }
+
+  /// Send Block data to the writer
+  virtual void prepare_remote (int * n, char ** buffer) throw();
+
+  /// Write Block data received from a non-writer
+  virtual void update_remote  ( int n, char * buffer) throw();
+
+  /// Free Block data sent to the writer
+  virtual void cleanup_remote (int * n, char ** buffer) throw();
+
+private: // functions
+
+  /// Append n bytes to the buffer
+  void append_ (const void * data, int n) throw();
+
+  /// Create the file and the Block index datasets
+  void create_file_ () throw();
+
+  /// Create the field datasets given the type and array size of each
+  /// field
+  void create_fields_ (const std::vector<int> & field_shape) throw();
+
+  /// Write the Blocks of one process from its buffer to the file
+  void write_blocks_ (const char * buffer, int n) throw();
+
+  /// Names of the field datasets, in the order written by
+  /// write_field_data()
+  std::vector<std::string> field_names_ () const throw();
+
+private: // attributes
+
+  // NOTE: only compress_level_ is pup'ed: the rest are only used
+  // during the output phase
+
+  /// Compression level for field datasets (0 for none)
+  int compress_level_;
+
+  /// Block data from this process, preceded by its process id
+  std::vector<char> buffer_;
+
+  /// Buffers received by the writer before the layout is known
+  std::vector< std::vector<char> > pending_;
+
+  /// Index of the first Block of each process in the writer's group,
+  /// with the total Block count last
+  std::vector<int> block_offset_;
+
+  /// Length of the longest Block name in any file
+  int name_len_;
+
+  /// Number of Blocks written to the file so far
+  int num_blocks_written_;
+
+  /// Type and array size of each field, or empty if the field
+  /// datasets are not yet created
+  std::vector<int> field_shape_;
+
+};
+
+#endif /* IO_OUTPUT_SHARED_HPP */
@@ -0,0 +1,209 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     io_OutputStage.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     Sat Oct 17 10:12:41 PDT 2026
+/// @brief    Implementation of the OutputStage class
+
+#include "cello.hpp"
+#include "io.hpp"
+
+//----------------------------------------------------------------------
+
+OutputStage::OutputStage(std::string dir, std::string file_name) throw()
+  : dir_(dir),
+    file_name_(file_name),
+    file_(nullptr),
+    is_created_(false),
+    file_meta_(),
+    groups_(),
+    is_complete_(false),
+    bytes_(0),
+    time_hidden_(0.0),
+    time_exposed_(0.0)
+{
+}
+
+//----------------------------------------------------------------------
+
+OutputStage::~OutputStage() throw()
+{
+  if (file_) {
+    file_->file_close();
+    delete file_;
+    file_ = nullptr;
+  }
+}
+
+//----------------------------------------------------------------------
+
+void OutputStage::add_file_meta (Io * io) throw()
+{
+  copy_meta_ (io,file_meta_);
+}
+
+//----------------------------------------------------------------------
+
+void OutputStage::add_group (std::string group_name, Io * io) throw()
+{
+  ASSERT1 ("OutputStage::add_group()",
+           "Adding group %s to completed stage",
+           group_name.c_str(), ! is_complete_);
+
+  groups_.push_back(Group());
+  groups_.back().name = group_name;
+  copy_meta_ (io,groups_.back().meta);
+}
+
+//----------------------------------------------------------------------
+
+void OutputStage::add_data
+(std::string name, int type,
+ int nxd, int nyd, int nzd,
+ int nx, int ny, int nz,
+ const void * buffer) throw()
+{
+  ASSERT1 ("OutputStage::add_data()",
+           "Adding dataset %s before any group",
+           name.c_str(), ! groups_.empty());
+
+  const int64_t n = int64_t(cello::type_bytes[type])*nx*ny*nz;
+
+  Array array;
+  array.name = name;
+  array.type = type;
+  array.nxd = nxd;
+  array.nyd = nyd;
+  array.nzd = nzd;
+  array.nx  = nx;
+  array.ny  = ny;
+  array.nz  = nz;
+  array.values.assign((const char *)buffer, (const char *)buffer + n);
+
+  groups_.back().data.push_back(array);
+  bytes_ += n;
+}
+
+//----------------------------------------------------------------------
+
+void OutputStage::append_data (int n, const void * buffer) throw()
+{
+  ASSERT ("OutputStage::append_data()",
+          "Appending to stage with no dataset",
+          ! groups_.empty() && ! groups_.back().data.empty());
+
+  Array & array = groups_.back().data.back();
+  const int64_t nb = int64_t(cello::type_bytes[array.type])*n;
+  array.values.insert(array.values.end(),
+                      (const char *)buffer, (const char *)buffer + nb);
+  array.nxd += n;
+  array.nx  += n;
+  bytes_ += nb;
+}
+
+//----------------------------------------------------------------------
+
+bool OutputStage::write_next () throw()
+{
+  if (! is_created_) {
+
+    // create the file and write file metadata
+
+    file_ = new FileHdf5 (dir_,file_name_);
+    file_->file_create();
+    is_created_ = true;
+
+    for (size_t i=0; i<file_meta_.size(); i++) {
+      const Array & meta = file_meta_[i];
+      file_->file_write_meta(meta.values.data(),meta.name.c_str(),meta.type,
+                             meta.nxd,meta.nyd,meta.nzd);
+      bytes_ -= meta.values.size();
+    }
+    file_meta_.clear();
+
+  } else if (! groups_.empty()) {
+
+    // write the oldest group
+
+    const Group & group = groups_.front();
+
+    file_->group_chdir("/" + group.name);
+    file_->group_create();
+
+    for (size_t i=0; i<group.meta.size(); i++) {
+      const Array & meta = group.meta[i];
+      file_->group_write_meta(meta.values.data(),meta.name.c_str(),meta.type,
+                              meta.nxd,meta.nyd,meta.nzd);
+      bytes_ -= meta.values.size();
+    }
+
+    for (size_t i=0; i<group.data.size(); i++) {
+      write_data_ (group.data[i]);
+      bytes_ -= group.data[i].values.size();
+    }
+
+    file_->group_close();
+
+    groups_.pop_front();
+
+  } else if (is_complete_ && file_ != nullptr) {
+
+    // close the file after the last group
+
+    file_->file_close();
+    delete file_;
+    file_ = nullptr;
+
+  } else {
+
+    // waiting for more groups, or already closed
+
+    return false;
+  }
+
+  return true;
+}
+
+//======================================================================
+
+void OutputStage::copy_meta_ (Io * io, std::vector<Array> & meta) throw()
+{
+  for (size_t i=0; i<io->meta_count(); i++) {
+
+    void * buffer;
+    Array array;
+    array.nx = array.ny = array.nz = 0;
+
+    io->meta_value(i,&buffer,&array.name,&array.type,
+                   &array.nxd,&array.nyd,&array.nzd);
+
+    const int64_t n = int64_t(cello::type_bytes[array.type])
+      * array.nxd * std::max(array.nyd,1) * std::max(array.nzd,1);
+
+    array.values.assign((const char *)buffer, (const char *)buffer + n);
+
+    meta.push_back(array);
+    bytes_ += n;
+  }
+}
+
+//----------------------------------------------------------------------
+
+void OutputStage::write_data_ (const Array & array) throw()
+{
+  // see OutputData::write_field_data()
+
+  const int nxd = array.nxd, nyd = array.nyd, nzd = array.nzd;
+  const int nx  = array.nx,  ny  = array.ny,  nz  = array.nz;
+
+  file_->mem_create(nx,ny,nz,nx,ny,nz,0,0,0);
+  if (nzd > 1) {
+    file_->data_create(array.name.c_str(),array.type,nzd,nyd,nxd,1,nz,ny,nx,1);
+  } else if (nyd > 1) {
+    file_->data_create(array.name.c_str(),array.type,nyd,nxd,  1,1,ny,nx, 1,1);
+  } else {
+    file_->data_create(array.name.c_str(),array.type,nxd,  1,  1,1,nx,  1,1,1);
+  }
+  file_->data_write(array.values.data());
+  file_->data_close();
+}
@@ -0,0 +1,141 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     io_OutputStage.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     Sat Oct 17 10:12:41 PDT 2026
+/// @brief    [\ref Io] Declaration of the OutputStage class
+
+#ifndef IO_OUTPUT_STAGE_HPP
+#define IO_OUTPUT_STAGE_HPP
+
+class File;
+class Io;
+
+class OutputStage {
+
+  /// @class    OutputStage
+  /// @ingroup  Io
+  /// @brief    [\ref Io] Copy of the data for one output file on one
+  /// process, written to disk incrementally after the output phase
+
+public: // functions
+
+  /// Create an empty OutputStage for the given file
+  OutputStage(std::string dir, std::string file_name) throw();
+
+  /// Delete the OutputStage, closing the file if open
+  ~OutputStage() throw();
+
+  /// Copy metadata from the Io object for the file
+  void add_file_meta (Io * io) throw();
+
+  /// Begin a new group, copying metadata from the Io object
+  void add_group (std::string group_name, Io * io) throw();
+
+  /// Copy an array into a dataset in the current group.  The buffer
+  /// has size nx*ny*nz and the dataset dimensions (nxd,nyd,nzd)
+  void add_data (std::string name, int type,
+                 int nxd, int nyd, int nzd,
+                 int nx, int ny, int nz,
+                 const void * buffer) throw();
+
+  /// Append n elements to the last dataset in the current group
+  void append_data (int n, const void * buffer) throw();
+
+  /// Mark that no more data will be added
+  void set_complete () throw()
+  { is_complete_ = true; }
+
+  /// Whether all data have been added
+  bool is_complete () const throw()
+  { return is_complete_; }
+
+  /// Write the next group to disk, creating the file first if needed
+  /// and closing it after the last group of a complete stage.
+  /// Return false if there is nothing to write
+  bool write_next () throw();
+
+  /// Whether all data have been added and written
+  bool is_done () const throw()
+  { return is_complete_ && is_created_ && file_ == nullptr; }
+
+  /// Number of bytes of data staged but not yet written
+  int64_t bytes () const throw()
+  { return bytes_; }
+
+  /// Path of the file
+  std::string file_path () const throw()
+  { return dir_ + "/" + file_name_; }
+
+  /// Add time spent writing this stage, either while otherwise idle
+  /// (hidden) or while the simulation waited (exposed)
+  void add_time (double time, bool is_hidden) throw()
+  { (is_hidden ? time_hidden_ : time_exposed_) += time; }
+
+  /// Time spent writing this stage while otherwise idle
+  double time_hidden () const throw()
+  { return time_hidden_; }
+
+  /// Time spent writing this stage while the simulation waited
+  double time_exposed () const throw()
+  { return time_exposed_; }
+
+private: // classes
+
+  /// Array of metadata or data values
+  struct Array {
+    std::string name;
+    int type;
+    int nxd, nyd, nzd;
+    int nx, ny, nz;
+    std::vector<char> values;
+  };
+
+  /// Group metadata and datasets for one Block
+  struct Group {
+    std::string name;
+    std::vector<Array> meta;
+    std::vector<Array> data;
+  };
+
+private: // functions
+
+  /// Copy metadata from the Io object
+  void copy_meta_ (Io * io, std::vector<Array> & meta) throw();
+
+  /// Write a dataset to the current group in the file
+  void write_data_ (const Array & array) throw();
+
+private: // attributes
+
+  /// Directory and name of the file
+  std::string dir_;
+  std::string file_name_;
+
+  /// File, or nullptr if not yet created or already closed
+  File * file_;
+
+  /// Whether the file has been created
+  bool is_created_;
+
+  /// File metadata
+  std::vector<Array> file_meta_;
+
+  /// Groups not yet written
+  std::deque<Group> groups_;
+
+  /// Whether all data have been added
+  bool is_complete_;
+
+  /// Bytes of data in file_meta_ and groups_
+  int64_t bytes_;
+
+  /// Time spent writing this stage while otherwise idle
+  double time_hidden_;
+
+  /// Time spent writing this stage while the simulation waited
+  double time_exposed_;
+
+};
+
+#endif /* IO_OUTPUT_STAGE_HPP */
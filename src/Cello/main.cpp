@@ -168,49 +168,54 @@ void Main::p_stopping_exit()
 
 //----------------------------------------------------------------------
 
-void Main::p_text_file_write
-(int nd, char * dir,
- int nf, char * file,
- int nl, char * line, int count)
+void Main::r_text_file_write(CkReductionMsg * msg)
 {
-  // Open file if first call. Increment count by number of pe's
-  std::string full_file = std::string(dir) + "/" + file;
+  // Buffer is a concatenation of "int n; char path[n]; int m; char
+  // data[m]" entries from OutputData::write_text_files_(); all entries
+  // for a path are appended to the same file
 
-  FILE * fp_text   = fp_text_[full_file];
-  Sync * sync_text = sync_text_[full_file];
-  
-  if (fp_text_[full_file] == NULL) {
-
-    // Create subdirectory if any
-    boost::filesystem::path directory(dir);
-    if (! boost::filesystem::is_directory(directory)) {
-      ASSERT1 ("Main::p_text_file_write()",
-	       "Error creating directory %s",
-	       dir,
-	       (boost::filesystem::create_directory(directory)));
+  std::map<std::string,FILE *> fp_text;
+
+  const char * buffer = (const char *) msg->getData();
+  const char * end    = buffer + msg->getSize();
+
+  while (buffer < end) {
+
+    int np, nd;
+    memcpy (&np,buffer,sizeof(int));  buffer += sizeof(int);
+    std::string path (buffer,np);     buffer += np;
+    memcpy (&nd,buffer,sizeof(int));  buffer += sizeof(int);
+    const char * data = buffer;       buffer += nd;
+
+    FILE * fp = fp_text[path];
+
+    if (fp == NULL) {
+
+      // Create subdirectory if any
+      boost::filesystem::path directory
+        (boost::filesystem::path(path).parent_path());
+      if (! directory.empty() && ! boost::filesystem::is_directory(directory)) {
+        ASSERT1 ("Main::r_text_file_write()",
+                 "Error creating directory %s",
+                 directory.string().c_str(),
+                 (boost::filesystem::create_directory(directory)));
+      }
+
+      fp = fp_text[path] = fopen(path.c_str(),"w");
+
+      ASSERT1 ("Main::r_text_file_write()",
+               "Error opening file %s",
+               path.c_str(), (fp != NULL));
     }
-    
-    fp_text   = fp_text_[full_file] = fopen(full_file.c_str(),"w");
-    sync_text = sync_text_[full_file] = new Sync;
-    
-    sync_text->set_stop(CkNumPes());
-  }
 
-  // First call from any Block on a processor includes count
-  // minus one for CkNumPes() above
-  if (count > 0) {
-    sync_text->inc_stop(count-1);
+    fwrite (data,1,nd,fp);
   }
 
-  fprintf (fp_text,"%s",line);
-
-  if (sync_text->next()) {
-    //    text_file_close_();
-    fclose(fp_text);
-    fp_text_[full_file] = NULL;
-    delete sync_text_[full_file];
-    sync_text_[full_file] = NULL;
+  for (auto it = fp_text.begin(); it != fp_text.end(); ++it) {
+    fclose(it->second);
   }
+
+  delete msg;
 }
 
 //----------------------------------------------------------------------
@@ -62,9 +62,7 @@ public:
     : CBase_Main(m),
       count_exit_(0),
       count_checkpoint_(0),
-      monitor_(NULL),
-      fp_text_(),
-      sync_text_()
+      monitor_(NULL)
   {
     for (int i=0; i<256; i++) dir_checkpoint_[i]='\0';
     TRACE("Main::Main(CkMigrateMessage)");
@@ -81,10 +79,6 @@ public:
     WARNING ("Main::pup","skipping monitor_");
     if (p.isUnpacking()) monitor_ = Monitor::instance();
     //    p|*monitor_;
-    WARNING ("Main::pup","skipping FILE * fp_text_");
-    //    p | fp_text_;
-    WARNING ("Main::pup","skipping FILE * sync_text_");
-    //    p | sync_text_;
   }
 
   /// Exit the program
@@ -106,10 +100,9 @@ public:
   void p_refresh_exit();
   void p_stopping_enter();
   void p_stopping_balance();
-  void p_text_file_write(int nd, char * dir,
-			 int nf, char * file,
-			 int nl, char * line,
-			 int count);
+  /// Write text and index files gathered from OutputData on all
+  /// processes
+  void r_text_file_write(CkReductionMsg * msg);
   void p_stopping_exit();
   void p_exit();
 
@@ -127,10 +120,4 @@ protected: // attributes
   char  dir_checkpoint_[256];
   Monitor * monitor_;
 
-  /// Mapping of file name to File pointer for p_text_file_write()
-  std::map<std::string,FILE *> fp_text_;
-
-  /// Mapping of file name to counter for writing text data
-  std::map<std::string,Sync *> sync_text_;
-
 };
@@ -29,10 +29,7 @@
      entry void p_stopping_enter();
      entry void p_stopping_balance();
      entry void p_stopping_exit();
-     entry void p_text_file_write(int nd, char dir[nd],
-     	                          int nf, char file[nf],
-     	                          int nl, char line[nl],
-				  int count);
+     entry void r_text_file_write(CkReductionMsg * msg);
      entry void p_exit();
 
   };
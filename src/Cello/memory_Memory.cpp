@@ -11,6 +11,7 @@
 
 #ifdef CONFIG_USE_MEMORY
 Memory Memory::instance_[CONFIG_NODE_SIZE]; // (singleton design pattern)
+std::atomic<int64_t> Memory::bytes_node_ (0);
 #endif
 
 //======================================================================
@@ -30,6 +31,9 @@ void Memory::initialize_()
   fill_new_    = 0xaa;
   fill_delete_ = 0xdd;
 
+  buffer_pool_ = true;
+  buffer_limit_ = int64_t(64e6);
+
   is_active_ = true;
 
 #endif
@@ -50,38 +54,45 @@ void * Memory::allocate ( size_t bytes )
   	      CkMyPe(),bytes,warning_mb_);
   }
 
+  // freed blocks held in the pool count toward the limit
+
   if (limit_gb_ != 0.0 && (bytes_curr_.size() > 0)  &&
-      ((bytes_curr_[0] + bytes) >= (1e9)*limit_gb_)) {
+      ((bytes_curr_[0] + pool_bytes_ + bytes) >= (1e9)*limit_gb_)) {
     // WARNING: do not use ERROR or ASSERT since allocates memory, leading to
     //          recursive calls to overloaded operator new 
     CkPrintf ("%d ERROR: Cannot allocate %ld bytes: limit is %f GB\n",
-	      CkMyPe(), (bytes_curr_[0] + bytes),limit_gb_);
+	      CkMyPe(), (bytes_curr_[0] + pool_bytes_ + bytes),limit_gb_);
     void * array[10];
     size_t size = backtrace(array,10);
     backtrace_symbols_fd(array,size,STDERR_FILENO);
     CmiAbort("MEMORY ALLOCATION ERROR");
   }
 
-  int * buffer = (int *)(malloc(bytes + 2*sizeof(int)));
+  int size_class, offset;
+  char * block = pool_allocate_(bytes,&size_class,&offset);
 
   ASSERT("Memory::allocate",
 	 "Cannot allocate buffer: out of memory",
-	 buffer);
+	 block);
 
-  if (is_active_) {
+  char * buffer = block + offset;
+  MemoryHeader * header = (MemoryHeader *)(buffer) - 1;
 
-    buffer[0] = bytes;
+  header->bytes      = bytes;
+  header->size_class = size_class;
+  header->offset     = offset;
 
-    buffer[1] = index_group_;
+  if (is_active_) {
+
+    header->index_group = index_group_;
 
     if (fill_new_) {
-      memset (&buffer[2],fill_new_,bytes);
+      memset (buffer,fill_new_,bytes);
     }
 
     ++ new_calls_[0] ;
     bytes_curr_[0] += bytes;
-    bytes_high_[0]    = MAX(bytes_high_[0],   bytes_curr_[0]);
-    bytes_highest_[0] = MAX(bytes_highest_[0],bytes_curr_[0]);
+    update_bytes_high_();
 
     if (index_group_ != 0) {
       ++ new_calls_[index_group_] ;
@@ -92,11 +103,12 @@ void * Memory::allocate ( size_t bytes )
 					 bytes_curr_[index_group_]);
     }
 
+    bytes_node_.fetch_add(bytes,std::memory_order_relaxed);
+
   } else {
-    buffer[0] = 0;
-    buffer[1] = 0;
+    header->index_group = -1;
   }
-  return (void *)(buffer + 2);
+  return (void *)(buffer);
 #else
   return 0;
 #endif
@@ -108,31 +120,256 @@ void Memory::deallocate ( void * pointer )
 {
 #ifdef CONFIG_USE_MEMORY
 
-  int *buffer = (int *)(pointer) - 2;
+  MemoryHeader * header = (MemoryHeader *)(pointer) - 1;
 
+  const int index_group = header->index_group;
 
   if (is_active_) {
 
-    int bytes = buffer[0];
+    // allocations made while inactive were not counted
+    const int64_t bytes = (index_group >= 0) ? header->bytes : 0;
 
     ++ delete_calls_[0] ;
     bytes_curr_[0] -= bytes;
 
-    int index_group = buffer[1];
-
-    if (index_group != 0) {
+    if (index_group > 0) {
       ++ delete_calls_[index_group] ;
       bytes_curr_[index_group] -= bytes;
     }
 
     if (fill_delete_) {
-      memset (&buffer[2],fill_delete_,bytes);
+      memset (pointer,fill_delete_,bytes);
+    }
+
+  }
+
+  // node-wide count is decremented even if this process is no longer
+  // active, since it was incremented when allocated
+  if (index_group >= 0) {
+    bytes_node_.fetch_sub(header->bytes,std::memory_order_relaxed);
+  }
+
+  pool_deallocate_ ((char *)(pointer) - header->offset, header->size_class);
+
+  if (is_active_) update_bytes_high_();
+
+#endif
+}
+
+//----------------------------------------------------------------------
+
+#ifdef CONFIG_USE_MEMORY
+
+char * Memory::pool_allocate_ (size_t bytes, int * size_class, int * offset)
+/// @param  bytes       Number of bytes requested
+/// @param  size_class  Returned size class of the block
+/// @param  offset      Returned offset of the buffer from the block start
+/// @return             Start of the block, or 0 if out of memory
+{
+  void * block = 0;
+
+  // Small size classes: carved from chunks and never returned to the
+  // system, so freed blocks are always held for reuse, and are
+  // counted in pool_bytes_ but exempt from pool_limit_; buffers are
+  // aligned to memory_header_small bytes
+
+  const size_t bytes_small = bytes + memory_header_small;
+
+  if (bytes_small <= memory_header_small*memory_num_small) {
+
+    const int ic = (bytes_small - 1) / memory_header_small;
+    (*size_class) = ic;
+    (*offset)     = memory_header_small;
+
+    char * list = pool_list_[ic];
+    if (list) {
+      pool_list_[ic] = *((char **)list);
+      pool_bytes_ -= class_size_(ic);
+      ++pool_hits_;
+      return list;
+    }
+    ++pool_misses_;
+    const size_t size = class_size_(ic);
+    if (chunk_free_ < size) {
+      if (posix_memalign (&block,memory_header_large,memory_chunk_bytes) != 0)
+        return 0;
+      chunk_curr_ = (char *)block;
+      chunk_free_ = memory_chunk_bytes;
     }
+    char * result = chunk_curr_;
+    chunk_curr_ += size;
+    chunk_free_ -= size;
+    return result;
+  }
+
+  // Larger blocks: buffers aligned to memory_header_large bytes
+
+  (*offset) = memory_header_large;
+
+  const size_t bytes_large = bytes + memory_header_large;
+
+  if (bytes_large <= (size_t(1) << memory_max_level)) {
+
+    // Geometric size classes: memory_num_sub classes for each power
+    // of two, with free blocks held for reuse up to pool_limit_ bytes
+
+    const int k = 63 - __builtin_clzll(bytes_large - 1);
+    const size_t q = (size_t(1) << k) / memory_num_sub;
+    const int j = (bytes_large - (size_t(1) << k) + q - 1) / q - 1;
+    const int ic = memory_num_small + memory_num_sub*(k - memory_min_level) + j;
+    (*size_class) = ic;
 
+    char * list = pool_list_[ic];
+    if (list) {
+      pool_list_[ic] = *((char **)list);
+      pool_bytes_ -= class_size_(ic);
+      ++pool_hits_;
+      return list;
+    }
+    ++pool_misses_;
+    if (posix_memalign (&block,memory_header_large,class_size_(ic)) != 0)
+      return 0;
+    return (char *) block;
   }
 
-  free(buffer);
+  // Allocations too large to pool
+
+  (*size_class) = memory_class_none;
+  if (posix_memalign (&block,memory_header_large,bytes_large) != 0)
+    return 0;
+  return (char *) block;
+}
+
+//----------------------------------------------------------------------
+
+void Memory::pool_deallocate_ (char * block, int size_class)
+/// @param  block       Start of the block
+/// @param  size_class  Size class of the block
+{
+  if (size_class == memory_class_none) {
+    free (block);
+  } else if (size_class < memory_num_small) {
+    // chunk memory cannot be returned to the system, so small blocks
+    // are held regardless of pool_limit_
+    *((char **)block) = pool_list_[size_class];
+    pool_list_[size_class] = block;
+    pool_bytes_ += class_size_(size_class);
+  } else {
+    const int64_t size = class_size_(size_class);
+    if (pool_bytes_ + size <= pool_limit_) {
+      *((char **)block) = pool_list_[size_class];
+      pool_list_[size_class] = block;
+      pool_bytes_ += size;
+    } else {
+      free (block);
+    }
+  }
+}
 
+#endif /* CONFIG_USE_MEMORY */
+
+//----------------------------------------------------------------------
+
+char * Memory::acquire_buffer (int64_t bytes)
+/// @param  bytes   Size of the buffer in bytes
+/// @return        Pointer to the buffer
+{
+#ifdef CONFIG_USE_MEMORY
+  Memory * memory = instance();
+
+  ++memory->buffers_active_;
+  memory->buffers_active_high_ =
+    MAX(memory->buffers_active_high_,memory->buffers_active_);
+
+  for (int i=0; i<memory_num_buffer_size; i++) {
+    char * buffer = memory->buffer_list_[i];
+    if (memory->buffer_bytes_[i] == bytes && buffer != nullptr) {
+      memory->buffer_list_[i] = *((char **)buffer);
+      memory->buffer_bytes_free_ -= bytes;
+      ++memory->buffer_hits_;
+      return buffer;
+    }
+  }
+  ++memory->buffer_misses_;
+#endif
+  return new char [bytes];
+}
+
+//----------------------------------------------------------------------
+
+void Memory::release_buffer (char * buffer, int64_t bytes)
+/// @param  buffer  Buffer returned by acquire_buffer()
+/// @param  bytes   Size of the buffer in bytes
+{
+  if (buffer == nullptr) return;
+
+#ifdef CONFIG_USE_MEMORY
+  Memory * memory = instance();
+
+  --memory->buffers_active_;
+
+  // hold the buffer only while held buffers stay within buffer_limit_
+
+  if (memory->buffer_pool_ && bytes >= int64_t(sizeof(char *)) &&
+      memory->buffer_bytes_free_ + bytes <= memory->buffer_limit_) {
+
+    // use the list for this size, or else any empty list
+
+    int index = -1;
+    for (int i=0; i<memory_num_buffer_size; i++) {
+      if (memory->buffer_bytes_[i] == bytes) {
+        index = i;
+        break;
+      } else if (index == -1 && memory->buffer_list_[i] == nullptr) {
+        index = i;
+      }
+    }
+    if (index != -1) {
+      memory->buffer_bytes_[index] = bytes;
+      *((char **)buffer) = memory->buffer_list_[index];
+      memory->buffer_list_[index] = buffer;
+      memory->buffer_bytes_free_ += bytes;
+      return;
+    }
+  }
+#endif
+  delete [] buffer;
+}
+
+//----------------------------------------------------------------------
+
+void Memory::set_buffer_pool (bool buffer_pool)
+{
+#ifdef CONFIG_USE_MEMORY
+  buffer_pool_ = buffer_pool;
+  trim_buffers_();
+#endif
+}
+
+//----------------------------------------------------------------------
+
+void Memory::set_buffer_limit_mb (float value)
+{
+#ifdef CONFIG_USE_MEMORY
+  buffer_limit_ = int64_t(1e6*value);
+  trim_buffers_();
+#endif
+}
+
+//----------------------------------------------------------------------
+
+void Memory::trim_buffers_()
+{
+#ifdef CONFIG_USE_MEMORY
+  const int64_t limit = buffer_pool_ ? buffer_limit_ : 0;
+  for (int i=0; i<memory_num_buffer_size; i++) {
+    while (buffer_bytes_free_ > limit && buffer_list_[i] != nullptr) {
+      char * buffer = buffer_list_[i];
+      buffer_list_[i] = *((char **)buffer);
+      buffer_bytes_free_ -= buffer_bytes_[i];
+      delete [] buffer;
+    }
+  }
 #endif
 }
 
@@ -249,7 +486,7 @@ int64_t Memory::bytes_limit ( std::string group_name )
 
 //----------------------------------------------------------------------
 
-int Memory::num_new ( std::string group_name )
+int64_t Memory::num_new ( std::string group_name )
 {
 #ifdef CONFIG_USE_MEMORY
   return new_calls_[index_group(group_name)];
@@ -260,7 +497,7 @@ int Memory::num_new ( std::string group_name )
 
 //----------------------------------------------------------------------
 
-int Memory::num_delete ( std::string group_name )
+int64_t Memory::num_delete ( std::string group_name )
 {
 #ifdef CONFIG_USE_MEMORY
   return delete_calls_[index_group(group_name)];
@@ -286,6 +523,17 @@ void Memory::print ()
       monitor->print ("Memory","  delete_calls  = %ld",long(delete_calls_[i]));
     }
   }
+  Monitor::instance()->print ("Memory","Pool");
+  Monitor::instance()->print ("Memory","  bytes_pool    = %ld",long(pool_bytes_));
+  Monitor::instance()->print ("Memory","  pool_hits     = %ld",long(pool_hits_));
+  Monitor::instance()->print ("Memory","  pool_misses   = %ld",long(pool_misses_));
+  Monitor::instance()->print ("Memory","Buffers");
+  Monitor::instance()->print ("Memory","  bytes_buffers = %ld",long(buffer_bytes_free_));
+  Monitor::instance()->print ("Memory","  buffer_limit  = %ld",long(buffer_limit_));
+  Monitor::instance()->print ("Memory","  active        = %ld",long(buffers_active_));
+  Monitor::instance()->print ("Memory","  active_high   = %ld",long(buffers_active_high_));
+  Monitor::instance()->print ("Memory","  buffer_hits   = %ld",long(buffer_hits_));
+  Monitor::instance()->print ("Memory","  buffer_misses = %ld",long(buffer_misses_));
 #endif
 }
 
@@ -315,6 +563,7 @@ void Memory::reset_high()
   for (size_t i=0; i<bytes_high_.size(); i++) {
     bytes_high_ [i] = bytes_curr_[i];
   }
+  if (bytes_high_.size() > 0) bytes_high_[0] += pool_bytes_;
 #endif
 }
 
@@ -9,6 +9,44 @@
 #ifndef MEMORY_MEMORY_HPP
 #define MEMORY_MEMORY_HPP
 
+/// Constants defining Memory pool size classes
+
+enum memory_pool_enum {
+  /// Header bytes (and alignment) for small size classes
+  memory_header_small = 16,
+  /// Header bytes (and alignment) for all other allocations
+  memory_header_large = 64,
+  /// Number of small size classes, spaced by memory_header_small bytes
+  memory_num_small    = 16,
+  /// log2 of smallest and largest block sizes for geometric size classes
+  memory_min_level    = 8,
+  memory_max_level    = 26,
+  /// Number of geometric size classes per power of two
+  memory_num_sub      = 4,
+  /// Total number of size classes
+  memory_num_class    = memory_num_small
+  +                     memory_num_sub*(memory_max_level - memory_min_level),
+  /// Size class of allocations too large to pool
+  memory_class_none   = -1,
+  /// Bytes allocated at a time for small size classes
+  memory_chunk_bytes  = 65536,
+  /// Number of distinct buffer sizes held by the buffer pool
+  memory_num_buffer_size = 16
+};
+
+/// Header stored immediately before each allocated buffer
+
+struct MemoryHeader {
+  /// Number of bytes requested
+  int64_t bytes;
+  /// Group charged for the allocation, or -1 if not tracked
+  int32_t index_group;
+  /// Pool size class, or memory_class_none
+  int16_t size_class;
+  /// Offset in bytes from the start of the block to the buffer
+  int16_t offset;
+};
+
 class Memory {
 
   /// @class    Memory
@@ -34,6 +72,9 @@ private: // interface
   : is_active_(false),
     warning_mb_(0.0),
     limit_gb_ (0.0)
+    // NOTE: pool attributes are not initialized here, since
+    // operator new may be called before the constructor of the
+    // static instance_ array; they rely on static zero-initialization
 #endif
   { initialize_(); }
 
@@ -121,10 +162,100 @@ public: // interface
   int64_t bytes_available ( std::string group = "" );
 
   /// Return the number of calls to allocate for the group
-  int num_new ( std::string group = "" );
+  int64_t num_new ( std::string group = "" );
 
   /// Return the number of calls to deallocate for the group
-  int num_delete ( std::string group = "" );
+  int64_t num_delete ( std::string group = "" );
+
+  /// Current number of bytes allocated on this node (all processes),
+  /// updated using atomic operations
+  static int64_t bytes_node ()
+#ifdef CONFIG_USE_MEMORY
+  { return bytes_node_.load(std::memory_order_relaxed); }
+#else
+  { return 0; }
+#endif
+
+  /// Number of allocations satisfied from the pool
+  int64_t num_pool_hits () const
+#ifdef CONFIG_USE_MEMORY
+  { return pool_hits_; }
+#else
+  { return 0; }
+#endif
+
+  /// Number of pooled allocations that required a new system allocation
+  int64_t num_pool_misses () const
+#ifdef CONFIG_USE_MEMORY
+  { return pool_misses_; }
+#else
+  { return 0; }
+#endif
+
+  /// Number of bytes in free blocks held in the pool for reuse
+  int64_t bytes_pool () const
+#ifdef CONFIG_USE_MEMORY
+  { return pool_bytes_; }
+#else
+  { return 0; }
+#endif
+
+  /// Borrow a buffer of the given size, reusing one returned by
+  /// release_buffer() if available.  Intended for arrays with a few
+  /// recurring sizes, e.g. Block-sized temporary fields.  Static so
+  /// that callers need not check for a Memory instance
+  static char * acquire_buffer (int64_t bytes);
+
+  /// Return a buffer from acquire_buffer() to the buffer pool
+  static void release_buffer (char * buffer, int64_t bytes);
+
+  /// Set whether released buffers are held for reuse; if not, held
+  /// buffers are freed
+  void set_buffer_pool (bool buffer_pool);
+
+  /// Set the maximum number of bytes in released buffers to hold for
+  /// reuse, freeing held buffers beyond the limit
+  void set_buffer_limit_mb (float value);
+
+  /// Number of buffers acquired but not yet released
+  int64_t num_buffers_active () const
+#ifdef CONFIG_USE_MEMORY
+  { return buffers_active_; }
+#else
+  { return 0; }
+#endif
+
+  /// Maximum number of buffers acquired at the same time
+  int64_t num_buffers_active_high () const
+#ifdef CONFIG_USE_MEMORY
+  { return buffers_active_high_; }
+#else
+  { return 0; }
+#endif
+
+  /// Number of buffer acquisitions reusing a released buffer
+  int64_t num_buffer_hits () const
+#ifdef CONFIG_USE_MEMORY
+  { return buffer_hits_; }
+#else
+  { return 0; }
+#endif
+
+  /// Number of buffer acquisitions requiring a new allocation
+  int64_t num_buffer_misses () const
+#ifdef CONFIG_USE_MEMORY
+  { return buffer_misses_; }
+#else
+  { return 0; }
+#endif
+
+  /// Number of bytes in released buffers held for reuse
+  int64_t bytes_buffers () const
+#ifdef CONFIG_USE_MEMORY
+  { return buffer_bytes_free_; }
+#else
+  { return 0; }
+#endif
 
   /// Print memory summary
   void print ();
@@ -182,6 +313,16 @@ public: // interface
 #endif
  }
 
+  /// Set the maximum number of bytes in free blocks to hold in the
+  /// pool for reuse (0 to free large blocks immediately).  Freed small
+  /// blocks are always held and count toward the limit
+  void set_pool_limit_mb (float value)
+  {
+#ifdef CONFIG_USE_MEMORY
+    pool_limit_ = int64_t(1e6*value);
+#endif
+  }
+
   //======================================================================
 
 private: // functions
@@ -189,6 +330,42 @@ private: // functions
   /// Initialize the memory component
   void initialize_();
 
+  /// Free held buffers until buffer_bytes_free_ is within buffer_limit_
+  void trim_buffers_();
+
+#ifdef CONFIG_USE_MEMORY
+
+  /// Return a block with room for the given number of bytes and
+  /// header, and its size class and buffer offset
+  char * pool_allocate_ (size_t bytes, int * size_class, int * offset);
+
+  /// Return the block to the pool or the system
+  void pool_deallocate_ (char * block, int size_class);
+
+  /// Update the total high-water marks, which include freed blocks
+  /// held in the pool since they are not returned to the system
+  void update_bytes_high_ ()
+  {
+    const int64_t bytes_held = bytes_curr_[0] + pool_bytes_;
+    bytes_high_[0]    = MAX(bytes_high_[0],   bytes_held);
+    bytes_highest_[0] = MAX(bytes_highest_[0],bytes_held);
+  }
+
+  /// Return the block size in bytes of the given size class
+  static size_t class_size_ (int size_class)
+  {
+    if (size_class < memory_num_small) {
+      return memory_header_small*(size_class + 1);
+    } else {
+      const int i  = size_class - memory_num_small;
+      const int k  = memory_min_level + i / memory_num_sub;
+      const int j  = i % memory_num_sub;
+      return (size_t(1) << k) + (j + 1)*(size_t(1) << k)/memory_num_sub;
+    }
+  }
+
+#endif
+
   //======================================================================
 
 private: // attributes
@@ -233,6 +410,57 @@ private: // attributes
   /// Limit on total memory allocated before error (to prevent crashing machine)
   float  limit_gb_;
 
+  /// Lists of free blocks for each size class, linked through the
+  /// first bytes of each block
+  char * pool_list_[memory_num_class];
+
+  /// Unused portion of the current chunk for small size classes
+  char * chunk_curr_;
+  size_t chunk_free_;
+
+  /// Bytes in free blocks held in all size class lists
+  int64_t pool_bytes_;
+
+  /// Limit on pool_bytes_ when holding geometric size class blocks.
+  /// Small size class blocks are always held, since their chunks are
+  /// never freed
+  int64_t pool_limit_;
+
+  /// Number of allocations reusing a free block
+  int64_t pool_hits_;
+
+  /// Number of pooled allocations requiring a new block
+  int64_t pool_misses_;
+
+  /// Current bytes allocated by all processes on this node
+  static std::atomic<int64_t> bytes_node_;
+
+  /// Whether released buffers are held for reuse
+  bool buffer_pool_;
+
+  /// Size in bytes of buffers in each buffer list
+  int64_t buffer_bytes_[memory_num_buffer_size];
+
+  /// Lists of released buffers of each size, linked through the
+  /// first bytes of each buffer
+  char * buffer_list_[memory_num_buffer_size];
+
+  /// Bytes in released buffers held for reuse
+  int64_t buffer_bytes_free_;
+
+  /// Limit on buffer_bytes_free_
+  int64_t buffer_limit_;
+
+  /// Current and maximum number of acquired buffers
+  int64_t buffers_active_;
+  int64_t buffers_active_high_;
+
+  /// Number of acquisitions reusing a released buffer
+  int64_t buffer_hits_;
+
+  /// Number of acquisitions requiring a new buffer
+  int64_t buffer_misses_;
+
 #endif
 
   /// The current group index, or 0 if none
@@ -78,7 +78,14 @@ Block::Block ( MsgRefine * msg )
     name_(""),
     index_method_(-1),
     index_solver_(),
-    refresh_()
+    refresh_(),
+    method_time_(),
+    solver_time_(0.0),
+    solver_obj_time_start_(0.0),
+    solver_method_time_start_(0.0),
+    field_version_(),
+    field_version_ghost_(),
+    id_refresh_interior_(-1)
 {
   performance_start_(perf_block);
 #ifdef DEBUG_NEW_REFRESH  
@@ -87,6 +94,7 @@ Block::Block ( MsgRefine * msg )
   init_new_refresh_();
 
   usesAtSync = true;
+  usesAutoMeasure = ! cello::config()->balance_cost_model;
   init (msg->index_,
 	msg->nx_, msg->ny_, msg->nz_,
 	msg->num_field_blocks_,
@@ -150,7 +158,14 @@ Block::Block ( process_type ip_source )
     name_(""),
     index_method_(-1),
     index_solver_(),
-    refresh_()
+    refresh_(),
+    method_time_(),
+    solver_time_(0.0),
+    solver_obj_time_start_(0.0),
+    solver_method_time_start_(0.0),
+    field_version_(),
+    field_version_ghost_(),
+    id_refresh_interior_(-1)
 {
 
 #ifdef DEBUG_NEW_REFRESH  
@@ -159,6 +174,7 @@ Block::Block ( process_type ip_source )
   init_new_refresh_();
 
   usesAtSync = true;
+  usesAutoMeasure = ! cello::config()->balance_cost_model;
 #ifdef TRACE_BLOCK
   int v3[3];
   index_.values(v3);
@@ -426,6 +442,9 @@ void Block::pup(PUP::er &p)
   p | index_method_;
   p | index_solver_;
   p | refresh_;
+  p | method_time_;
+  p | solver_time_;
+  // SKIP solver_obj_time_start_, solver_method_time_start_: not in a Solver
   // SKIP method_: initialized when needed
 
   if (up) DEBUG_FACES("PUP");
@@ -684,6 +703,7 @@ void Block::p_refresh_child
  int    ic3[3]
  )
 {
+  TRACER_ENTRY("Block::p_refresh_child");
   performance_start_(perf_refresh_child);
   int  if3[3]  = {0,0,0};
   bool lg3[3] = {false,false,false};
@@ -734,7 +754,14 @@ Block::Block ()
     name_(""),
     index_method_(-1),
     index_solver_(),
-    refresh_()
+    refresh_(),
+    method_time_(),
+    solver_time_(0.0),
+    solver_obj_time_start_(0.0),
+    solver_method_time_start_(0.0),
+    field_version_(),
+    field_version_ghost_(),
+    id_refresh_interior_(-1)
 {
 
   init_new_refresh_();
@@ -772,7 +799,14 @@ Block::Block (CkMigrateMessage *m)
     name_(""),
     index_method_(-1),
     index_solver_(),
-    refresh_()
+    refresh_(),
+    method_time_(),
+    solver_time_(0.0),
+    solver_obj_time_start_(0.0),
+    solver_method_time_start_(0.0),
+    field_version_(),
+    field_version_ghost_(),
+    id_refresh_interior_(-1)
     
 {
 
@@ -284,20 +284,31 @@ public: // interface
   //--------------------------------------------------
 
   void p_compute_enter()
-  {      compute_enter_();  }
+  {
+    TRACER_ENTRY("Block::p_compute_enter");
+    compute_enter_();
+  }
 
   void p_compute_continue()
-  {      compute_continue_();  }
+  {
+    TRACER_ENTRY("Block::p_compute_continue");
+    compute_continue_();
+  }
   void r_compute_continue(CkReductionMsg * msg)
   {
+    TRACER_ENTRY("Block::r_compute_continue");
     delete msg;
     compute_continue_();
   }
 
   void p_compute_exit()
-  {      compute_exit_();  }
+  {
+    TRACER_ENTRY("Block::p_compute_exit");
+    compute_exit_();
+  }
   void r_compute_exit(CkReductionMsg * msg)
   {
+    TRACER_ENTRY("Block::r_compute_exit");
     delete msg;
     compute_exit_();
   }
@@ -353,6 +364,17 @@ protected: // methods
   /// Exit control compute phase
   void compute_exit_();
 
+  /// Mark all fields as modified with ghost zones not current
+  void field_version_reset_();
+  /// Mark fields that the Method may write to as modified
+  void field_version_update_(Method * method);
+  /// Remove fields from the Refresh object whose ghost zones are
+  /// current; return false if no data remain to be refreshed
+  bool refresh_plan_(Refresh & refresh);
+  /// Apply the current Method's compute_interior() if it overlaps
+  /// the given refresh
+  void compute_interior_(int id_refresh);
+
 public: // methods
 
   /// Prepare to call compute_next_() after computing (used to
@@ -533,6 +555,7 @@ public:
   /// supplied once with others count arguments 0.
   void p_control_sync_count(int entry_point, int id, int count)
   {
+    TRACER_ENTRY("Block::p_control_sync_count");
     performance_start_(perf_control);
     control_sync_count(entry_point,id, count);
     performance_stop_(perf_control);
@@ -551,8 +574,11 @@ public:
   // REFRESH
   //--------------------------------------------------
 
-  /// Begin a refresh operation, optionally waiting then invoking callback
-  void new_refresh_start (int id_refresh, int callback);
+  /// Begin a refresh operation, optionally waiting then invoking
+  /// callback.  If refresh_plan is given it is used instead of the
+  /// registered Refresh object to determine which data to send
+  void new_refresh_start (int id_refresh, int callback,
+                          Refresh * refresh_plan = nullptr);
 
   /// Wait for a refresh operation to complete, then continue with the callback
   void new_refresh_wait (int id_refresh, int callback);
@@ -564,6 +590,10 @@ public:
   /// Receive a Refresh data message from an adjacent Block
   void p_new_refresh_recv (MsgRefresh * msg);
 
+  /// Count a face copied directly into this Block's ghost zones by an
+  /// adjacent Block on the same process
+  void p_new_refresh_copy_done (int id_refresh);
+
   int new_refresh_load_field_faces_ (Refresh & refresh);
   /// Scatter particles in ghost zones to neighbors
   int new_refresh_load_particle_faces_ (Refresh & refresh, const bool copy = false);
@@ -584,6 +614,17 @@ public:
 
   void new_refresh_exit (Refresh & refresh);
 
+  /// Send a refresh message to the given neighbor, or hold it in the
+  /// Simulation for aggregation with other messages to the same
+  /// process if Mesh:refresh_aggregate is true
+  void new_refresh_send_ (Index index, MsgRefresh * msg);
+
+  /// Copy field faces directly into the ghost zones of the given
+  /// neighbor if it is on this process and is ready to receive
+  /// refresh data; returns false if a message must be sent instead
+  bool new_refresh_copy_field_face_
+  (Refresh & refresh, int refresh_type, Index index, int if3[3], int ic3[3]);
+
   /// Enter the refresh phase after synchronizing
   void p_refresh_continue ()
   {
@@ -810,6 +851,22 @@ public: // virtual functions
 
   void ResumeFromSync();
 
+  /// Set the load used by the Charm++ load balancer to the Block's
+  /// estimated cost if Balance:cost_model is true
+  void UserSetLBLoad();
+
+  /// Return the estimated cost of the Block from measured Method
+  /// compute and Solver times and the number of particles
+  double cost() const;
+
+  /// Start charging Solver time to the Block cost if not already in
+  /// a Solver; called by Solver::begin_()
+  void solver_time_start();
+
+  /// Stop charging Solver time to the Block cost if no longer in a
+  /// Solver; called by Solver::end_()
+  void solver_time_stop();
+
   FieldFace * create_face
   (int if3[3], int ic3[3], bool lg3[3],
    int refresh_type,
@@ -1044,6 +1101,34 @@ protected: // attributes
   /// (Not a pointer since must be one per Block for synchronization counters)
   std::vector<Refresh*> refresh_;
 
+  /// Wallclock time spent in each Method's compute() since the last
+  /// load balancing step, used for Balance:cost_model
+  std::vector<double> method_time_;
+
+  /// Wallclock time spent in entry methods while in a Solver, less
+  /// Method compute() time, since the last load balancing step, used
+  /// for Balance:cost_model
+  double solver_time_;
+
+  /// Charm++ measured object time when the outermost Solver began
+  /// (not migrated)
+  double solver_obj_time_start_;
+
+  /// Total Method compute() time when the outermost Solver began
+  /// (not migrated)
+  double solver_method_time_start_;
+
+  /// Version of each field, incremented whenever a Method that may
+  /// modify it is applied (reset each compute phase; not migrated)
+  std::vector<int> field_version_;
+
+  /// Field version when ghost zones were last refreshed
+  std::vector<int> field_version_ghost_;
+
+  /// Id of the refresh to overlap with the current Method's
+  /// compute_interior(), or -1 if none (not migrated)
+  int id_refresh_interior_;
+
   std::vector < Sync > new_refresh_sync_list_;
   std::vector < std::vector <MsgRefresh * > > new_refresh_msg_list_;
 
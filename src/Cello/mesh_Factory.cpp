@@ -236,6 +236,11 @@ void Factory::create_block
 
   cello::simulation()->set_msg_refine (index,msg);
 
-  block_array[index].insert (process_type(CkMyPe()));
+  // insert on this (the parent Block's) process if requested,
+  // otherwise on the process given by MappingArray
+
+  const int ip = cello::config()->mesh_mapping_parent ? CkMyPe() : -1;
+
+  block_array[index].insert (process_type(CkMyPe()), ip);
 }
 
@@ -64,6 +64,12 @@ public: // interface
   /// Clear the output field to the default coarsen (-1)
   void * initialize_output_(FieldData * field_data);
 
+  /// Whether apply() writes a refinement field.  Criteria without one
+  /// stop evaluating cells once refinement is certain, and may be
+  /// skipped entirely once another criterion requires refinement
+  bool has_output() const throw()
+  { return output_ != ""; }
+
   /// Return the Schedule object pointer
   Schedule * schedule() throw() 
   { return schedule_; }
@@ -79,20 +79,25 @@ int RefineDensity::apply_
   int gx, int gy, int gz ) const throw ()
 {
 
-  bool any_refine  = false;
+  // reduce each row to its minimum and maximum without branches so
+  // the inner loop may be vectorized, and stop at the first row that
+  // requires refinement
+
   bool all_coarsen = true;
   for (int iz=gz; iz<mz-gz; iz++) {
     for (int iy=gy; iy<my-gy; iy++) {
+      const T * row = array + mx*(iy + my*iz);
+      T row_min = row[gx];
+      T row_max = row[gx];
       for (int ix=gx; ix<mx-gx; ix++) {
-	int i = ix + mx*(iy + my*iz);
-	if (array[i] > min_refine_)  any_refine  = true;
-	if (array[i] < max_coarsen_) all_coarsen = false;
+	row_min = std::min(row_min,row[ix]);
+	row_max = std::max(row_max,row[ix]);
       }
+      if (row_max > min_refine_)  return adapt_refine;
+      if (row_min < max_coarsen_) all_coarsen = false;
     }
   }
-  return 
-    any_refine ?  adapt_refine :
-    (all_coarsen ? adapt_coarsen : adapt_same) ;
+  return all_coarsen ? adapt_coarsen : adapt_same;
 
 }
 
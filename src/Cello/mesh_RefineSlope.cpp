@@ -54,51 +54,85 @@ int RefineSlope::apply ( Block * block ) throw ()
 
   void * output = initialize_output_(field.field_data());
 
-  for (size_t k=0; k<field_id_list_.size(); k++) {
+  // Fields with the same precision, size, and ghost depth (the usual
+  // case) are evaluated together in one sweep over the Block;
+  // otherwise each field is swept separately
 
-    int id_field = field_id_list_[k];
+  const int nf = field_id_list_.size();
 
-    int gx,gy,gz;
-    if (include_ghosts_) {
-      gx = (rank >= 1) ? 1 : 0;
-      gy = (rank >= 2) ? 1 : 0;
-      gz = (rank >= 3) ? 1 : 0;
-    } else {
-      field.ghost_depth(id_field, &gx,&gy,&gz);
+  std::vector<void *> arrays;
+  int mx=0,my=0,mz=0;
+  int gx=0,gy=0,gz=0;
+  precision_type precision = precision_unknown;
+
+  for (int k=0; k<=nf; k++) {
+
+    int id_field = (k < nf) ? field_id_list_[k] : -1;
+
+    int kmx=0,kmy=0,kmz=0;
+    int kgx=0,kgy=0,kgz=0;
+    precision_type k_precision = precision_unknown;
+
+    if (id_field >= 0) {
+      if (include_ghosts_) {
+        kgx = (rank >= 1) ? 1 : 0;
+        kgy = (rank >= 2) ? 1 : 0;
+        kgz = (rank >= 3) ? 1 : 0;
+      } else {
+        field.ghost_depth(id_field, &kgx,&kgy,&kgz);
+      }
+      field.dimensions(id_field,&kmx,&kmy,&kmz);
+      k_precision = field.precision(id_field);
     }
 
-    int mx,my,mz;
-    field.dimensions(id_field,&mx,&my,&mz);
-
-    precision_type precision = field.precision(id_field);
-
-    void * array = field.values(id_field);
-   
-    // count number of times slope refine and coarsen conditions are satisified
-    switch (precision) {
-    case precision_single:
-      evaluate_block_((float*) array,
-		      (float*) output, 
-		      mx,my,mz,gx,gy,gz,
-		      &any_refine,&all_coarsen, rank,h3);
-      break;
-    case precision_double:
-      evaluate_block_((double*) array,
-		      (double*) output,
-		      mx,my,mz,gx,gy,gz,
-		      &any_refine,&all_coarsen, rank,h3);
-      break;
-    case precision_quadruple:
-      evaluate_block_((long double*) array,
-		      (long double*) output,
-		      mx,my,mz,gx,gy,gz,
-		      &any_refine,&all_coarsen, rank,h3);
-      break;
-    default:
-      ERROR2("RefineSlope::apply",
-	     "Unknown precision %d for field %d",
-	     precision,0);
-      break;
+    const bool same_layout = (arrays.size() > 0) &&
+      (k_precision == precision) &&
+      (kmx == mx) && (kmy == my) && (kmz == mz) &&
+      (kgx == gx) && (kgy == gy) && (kgz == gz);
+
+    // evaluate the fields gathered so far if this one differs
+
+    if (arrays.size() > 0 && ! same_layout) {
+
+      const int na = arrays.size();
+
+      switch (precision) {
+      case precision_single:
+        evaluate_block_((const float**) arrays.data(), na,
+                        (float*) output,
+                        mx,my,mz,gx,gy,gz,
+                        &any_refine,&all_coarsen, rank,h3);
+        break;
+      case precision_double:
+        evaluate_block_((const double**) arrays.data(), na,
+                        (double*) output,
+                        mx,my,mz,gx,gy,gz,
+                        &any_refine,&all_coarsen, rank,h3);
+        break;
+      case precision_quadruple:
+        evaluate_block_((const long double**) arrays.data(), na,
+                        (long double*) output,
+                        mx,my,mz,gx,gy,gz,
+                        &any_refine,&all_coarsen, rank,h3);
+        break;
+      default:
+        ERROR2("RefineSlope::apply",
+               "Unknown precision %d for field %d",
+               precision,field_id_list_[k-1]);
+        break;
+      }
+      arrays.clear();
+
+      // remaining fields cannot change the result
+
+      if (any_refine && ! output) break;
+    }
+
+    if (id_field >= 0) {
+      arrays.push_back(field.values(id_field));
+      mx = kmx; my = kmy; mz = kmz;
+      gx = kgx; gy = kgy; gz = kgz;
+      precision = k_precision;
     }
   }
 
@@ -115,7 +149,8 @@ int RefineSlope::apply ( Block * block ) throw ()
 //----------------------------------------------------------------------
 
 template <class T>
-void RefineSlope::evaluate_block_(T * array, T * output ,
+void RefineSlope::evaluate_block_(const T ** arrays, int nf,
+				  T * output ,
 				  int mx, int my, int mz,
 				  int gx, int gy, int gz,
 				  bool *any_refine,
@@ -123,29 +158,58 @@ void RefineSlope::evaluate_block_(T * array, T * output ,
 				  int rank, 
 				  double * h3 )
 {
-  T slope;
   const int d3[3] = {1,mx,mx*my};
-  T tiny = 1e-10;
-  int count=0;
-  for (int axis=0; axis<rank; axis++) {
-    int id = d3[axis];
-    for (int iz=gz; iz<mz-gz; iz++) {
-      for (int iy=gy; iy<my-gy; iy++) {
-	for (int ix=gx; ix<mx-gx; ix++) {
-	  int i = ix + mx*(iy + my*iz);
-	  T a = std::max(T(2.0*h3[axis]*fabs(array[i])),tiny);
-	  slope = fabs( (array[i+id] - array[i-id]) / a);
-	  count++;
-	  if (slope > min_refine_)  *any_refine  = true;
-	  if (slope > max_coarsen_) *all_coarsen = false;
-	  if (output) {
-	    if (slope > max_coarsen_) output[i] =  0;
-	    if (slope > min_refine_)  output[i] = +1;
-	  }
-	}
+  const T tiny = 1e-10;
+  const T min_refine  = min_refine_;
+  const T max_coarsen = max_coarsen_;
+
+  // maximum slope over fields and axes for each cell in a row; inner
+  // loops have no branches so they may be vectorized
+
+  const int nx = mx - 2*gx;
+  std::vector<T> slope_row (nx);
+
+  for (int iz=gz; iz<mz-gz; iz++) {
+    for (int iy=gy; iy<my-gy; iy++) {
+
+      const int i0 = gx + mx*(iy + my*iz);
+
+      for (int ix=0; ix<nx; ix++) slope_row[ix] = 0.0;
+
+      for (int k=0; k<nf; k++) {
+        const T * array = arrays[k] + i0;
+        for (int axis=0; axis<rank; axis++) {
+          const int id = d3[axis];
+          const T h2 = 2.0*h3[axis];
+          for (int ix=0; ix<nx; ix++) {
+            T a = std::max(T(h2*fabs(array[ix])),tiny);
+            T slope = fabs( (array[ix+id] - array[ix-id]) / a);
+            slope_row[ix] = std::max(slope_row[ix],slope);
+          }
+        }
+      }
+
+      T slope_max = 0.0;
+      for (int ix=0; ix<nx; ix++) {
+        slope_max = std::max(slope_max,slope_row[ix]);
+      }
+
+      if (output) {
+        for (int ix=0; ix<nx; ix++) {
+          const T slope = slope_row[ix];
+          if (slope > max_coarsen) output[i0+ix] = std::max(output[i0+ix],T(0));
+          if (slope > min_refine)  output[i0+ix] = +1;
+        }
+      }
+
+      if (slope_max > max_coarsen) *all_coarsen = false;
+      if (slope_max > min_refine)  {
+        *any_refine  = true;
+        // refinement is certain: the remaining cells only matter
+        // for the output field
+        if (! output) return;
       }
     }
   }
 }
 //======================================================================
-
@@ -48,8 +48,10 @@ public: // interface
 
 private: // functions
 
+  /// Evaluate nf fields with the same layout in one sweep, stopping
+  /// early if refinement is certain and there is no output field
   template <class T>
-  void evaluate_block_(T * array,  T * output,
+  void evaluate_block_(const T ** arrays, int nf, T * output,
 		       int ndx, int ndy, int ndz,
 		       int gx, int gy, int gz,
 		       bool * any_refine,
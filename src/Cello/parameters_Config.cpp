@@ -44,6 +44,8 @@ void Config::pup (PUP::er &p)
   // Balance
 
   p | balance_schedule_index;
+  p | balance_cost_model;
+  p | balance_cost_particle;
 
   // Boundary
 
@@ -70,6 +72,7 @@ void Config::pup (PUP::er &p)
   PUParray(p,field_ghost_depth,3);
   p | field_padding;
   p | field_history;
+  p | field_history_list;
   p | field_precision;
   p | field_prolong;
   p | field_restrict;
@@ -93,6 +96,9 @@ void Config::pup (PUP::er &p)
   p | memory_active;
   p | memory_warning_mb;
   p | memory_limit_gb;
+  p | memory_pool_limit_mb;
+  p | memory_buffer_pool;
+  p | memory_buffer_limit_mb;
 
   // Mesh
 
@@ -102,6 +108,12 @@ void Config::pup (PUP::er &p)
   p | mesh_min_level;
   p | mesh_max_level;
   p | mesh_max_initial_level;
+  p | mesh_refresh_aggregate;
+  p | mesh_refresh_local_copy;
+  p | mesh_refresh_skip_current;
+  p | mesh_mapping;
+  p | mesh_mapping_parent;
+  p | mesh_mapping_diagnostic;
 
   // Method
 
@@ -116,6 +128,7 @@ void Config::pup (PUP::er &p)
   p | method_flux_correct_group;
   p | method_flux_correct_enable;
   p | method_flux_correct_min_digits;
+  p | method_overlap_refresh;
   p | method_timestep;
   p | method_trace_name;
   p | method_null_dt;
@@ -154,6 +167,10 @@ void Config::pup (PUP::er &p)
   p | output_dir_global;
   p | output_stride_write;
   p | output_stride_wait;
+  p | output_async;
+  p | output_async_staging_mb;
+  p | output_block_index;
+  p | output_compress;
   p | output_field_list;
   p | output_particle_list;
   p | output_name;
@@ -188,6 +205,11 @@ void Config::pup (PUP::er &p)
   p | performance_warnings;
   p | performance_on_schedule_index;
   p | performance_off_schedule_index;
+  p | performance_trace_file;
+  p | performance_trace_format;
+  p | performance_timeline_cycles;
+  p | performance_timeline_file;
+  p | performance_timeline_size;
 
   // Physics
   
@@ -371,6 +393,9 @@ void Config::read_balance_ (Parameters * p) throw()
 
   p->group_clear();
 
+  balance_cost_model    = p->value_logical ("Balance:cost_model",false);
+  balance_cost_particle = p->value_float   ("Balance:cost_particle",0.0);
+
   const bool balance_scheduled = 
     (p->type("Balance:schedule:var") != parameter_unknown);
 
@@ -581,6 +606,12 @@ void Config::read_field_ (Parameters * p) throw()
 
   field_history = p->value_integer("Field:history",0);
 
+  const int num_history_list = p->list_length("Field:history_list");
+  field_history_list.resize(num_history_list);
+  for (int i=0; i<num_history_list; i++) {
+    field_history_list[i] = p->list_value_string(i,"Field:history_list");
+  }
+
   // Field precision
 
   std::string precision_str = p->value_string("Field:precision","default");
@@ -642,6 +673,9 @@ void Config::read_memory_ (Parameters * p) throw()
   memory_active = p->value_logical("Memory:active",true);
   memory_warning_mb =  p->value_float("Memory:warning_mb",0.0);
   memory_limit_gb =    p->value_float("Memory:limit_gb",0.0);
+  memory_pool_limit_mb = p->value_float("Memory:pool_limit_mb",16.0);
+  memory_buffer_pool = p->value_logical("Memory:buffer_pool",true);
+  memory_buffer_limit_mb = p->value_float("Memory:buffer_limit_mb",64.0);
 }
 
 //----------------------------------------------------------------------
@@ -691,6 +725,31 @@ void Config::read_mesh_ (Parameters * p) throw()
 
   mesh_min_level = p->value_integer("Adapt:min_level",0);
 
+  //--------------------------------------------------
+
+  mesh_refresh_aggregate = p->value_logical("Mesh:refresh_aggregate",false);
+
+  mesh_refresh_local_copy = p->value_logical("Mesh:refresh_local_copy",false);
+
+  mesh_refresh_skip_current =
+    p->value_logical("Mesh:refresh_skip_current",false);
+
+  //--------------------------------------------------
+
+  mesh_mapping = p->value_string("Mesh:mapping","linear");
+
+  ASSERT1 ("Config::read_mesh_()",
+	   "Mesh:mapping \"%s\" must be \"linear\", \"morton\", or \"hilbert\"",
+	   mesh_mapping.c_str(),
+	   (mesh_mapping == "linear" ||
+	    mesh_mapping == "morton" ||
+	    mesh_mapping == "hilbert"));
+
+  mesh_mapping_parent = p->value_logical("Mesh:mapping_parent",false);
+
+  mesh_mapping_diagnostic =
+    p->value_logical("Mesh:mapping_diagnostic",false);
+
 }
 
 //----------------------------------------------------------------------
@@ -710,6 +769,7 @@ void Config::read_method_ (Parameters * p) throw()
   method_flux_correct_group.resize(num_method);
   method_flux_correct_enable.resize(num_method);
   method_flux_correct_min_digits.resize(num_method);
+  method_overlap_refresh.resize(num_method);
   method_timestep.resize(num_method);
   method_schedule_index.resize(num_method);
   method_close_files_seconds_stagger.resize(num_method);
@@ -754,6 +814,10 @@ void Config::read_method_ (Parameters * p) throw()
     // Read courant condition if any
     method_courant[index_method] = p->value_float  (full_name + ":courant",1.0);
 
+    // Read whether to overlap interior computation with refresh
+    method_overlap_refresh[index_method] =
+      p->value_logical (full_name + ":overlap_refresh",false);
+
     // Read field group for flux correction
     method_flux_correct_group[index_method] =
       p->value_string (full_name + ":group","conserved");
@@ -827,6 +891,10 @@ void Config::read_output_ (Parameters * p) throw()
   output_dir.resize(num_output);
   output_stride_write.resize(num_output);
   output_stride_wait.resize(num_output);
+  output_async.resize(num_output);
+  output_async_staging_mb.resize(num_output);
+  output_block_index.resize(num_output);
+  output_compress.resize(num_output);
   output_field_list.resize(num_output);
   output_particle_list.resize(num_output);
   output_name.resize(num_output);
@@ -854,6 +922,15 @@ void Config::read_output_ (Parameters * p) throw()
 
     output_stride_wait[index_output] = p->value_integer("stride_wait",0);
 
+    output_async[index_output] = p->value_logical("async",false);
+
+    output_async_staging_mb[index_output] =
+      p->value_float("async_staging_mb",0.0);
+
+    output_block_index[index_output] = p->value_logical("block_index",false);
+
+    output_compress[index_output] = p->value_integer("compress",0);
+
     if (p->type("dir") == parameter_string) {
       output_dir[index_output].resize(1);
       output_dir[index_output][0] = p->value_string("dir","");
@@ -1210,6 +1287,31 @@ void Config::read_performance_ (Parameters * p) throw()
 
   performance_warnings = p->value_logical("Performance:warnings",false);
 
+  performance_trace_file = p->value_string("Performance:trace:file","");
+  performance_trace_format = p->value_string("Performance:trace:format","csv");
+
+  ASSERT1 ("Config::read_performance_()",
+           "Performance:trace:format is \"%s\" but must be \"csv\" or \"json\"",
+           performance_trace_format.c_str(),
+           (performance_trace_format == "csv" ||
+            performance_trace_format == "json"));
+
+  performance_timeline_cycles.clear();
+  if (p->type("Performance:timeline:cycles") == parameter_list) {
+    const int length = p->list_length("Performance:timeline:cycles");
+    for (int i=0; i<length; i++) {
+      performance_timeline_cycles.push_back
+        (p->list_value_integer(i,"Performance:timeline:cycles"));
+    }
+  } else if (p->type("Performance:timeline:cycles") == parameter_integer) {
+    performance_timeline_cycles.push_back
+      (p->value_integer("Performance:timeline:cycles"));
+  }
+  performance_timeline_file = p->value_string
+    ("Performance:timeline:file","timeline");
+  performance_timeline_size = p->value_integer
+    ("Performance:timeline:size",100000);
+
 #ifdef CONFIG_USE_PROJECTIONS
   
   int i_on = -1;
@@ -39,6 +39,8 @@ public: // interface
     adapt_output(),
     adapt_schedule_index(),
     balance_schedule_index(0),
+    balance_cost_model(false),
+    balance_cost_particle(0.0),
     num_boundary(0),
     boundary_list(),
     boundary_type(),
@@ -52,6 +54,7 @@ public: // interface
     field_alignment(0),
     field_padding(0),
     field_history(0),
+    field_history_list(),
     field_precision(0),
     field_prolong(""),
     field_restrict(""),
@@ -69,10 +72,19 @@ public: // interface
     memory_active(false),
     memory_warning_mb(0.0),
     memory_limit_gb(0.0),
+    memory_pool_limit_mb(0.0),
+    memory_buffer_pool(true),
+    memory_buffer_limit_mb(0.0),
     mesh_root_rank(0),
     mesh_min_level(0),
     mesh_max_level(0),
     mesh_max_initial_level(0),
+    mesh_refresh_aggregate(false),
+    mesh_refresh_local_copy(false),
+    mesh_refresh_skip_current(false),
+    mesh_mapping("linear"),
+    mesh_mapping_parent(false),
+    mesh_mapping_diagnostic(false),
     num_method(0),
     method_courant_global(1.0),
     method_list(),
@@ -84,6 +96,7 @@ public: // interface
     method_flux_correct_group(),
     method_flux_correct_enable(),
     method_flux_correct_min_digits(),
+    method_overlap_refresh(),
     method_timestep(),
     method_trace_name(),
   // MethodNull
@@ -116,6 +129,10 @@ public: // interface
     output_dir(),
     output_stride_write(),
     output_stride_wait(),
+    output_async(),
+    output_async_staging_mb(),
+    output_block_index(),
+    output_compress(),
     output_field_list(),
     output_particle_list(),
     output_name(),
@@ -142,6 +159,11 @@ public: // interface
     performance_warnings(false),
     performance_on_schedule_index(-1),
     performance_off_schedule_index(-1),
+    performance_trace_file(""),
+    performance_trace_format("csv"),
+    performance_timeline_cycles(),
+    performance_timeline_file(""),
+    performance_timeline_size(0),
     num_physics(0),
     physics_list(),
     restart_file(""),
@@ -196,6 +218,8 @@ public: // interface
       adapt_output(),
       adapt_schedule_index(),
       balance_schedule_index(-1),
+      balance_cost_model(false),
+      balance_cost_particle(0.0),
       num_boundary(0),
       boundary_list(),
       boundary_type(),
@@ -209,6 +233,7 @@ public: // interface
       field_alignment(0),
       field_padding(0),
       field_history(0),
+      field_history_list(),
       field_precision(0),
       field_prolong(""),
       field_restrict(""),
@@ -226,10 +251,20 @@ public: // interface
       memory_active(false),
       memory_warning_mb(0.0),
       memory_limit_gb(0.0),
+      memory_pool_limit_mb(0.0),
+      memory_buffer_pool(true),
+      memory_buffer_limit_mb(0.0),
+    memory_buffer_limit_mb(0.0),
       mesh_root_rank(0),
       mesh_min_level(0),
       mesh_max_level(0),
       mesh_max_initial_level(0),
+      mesh_refresh_aggregate(false),
+      mesh_refresh_local_copy(false),
+      mesh_refresh_skip_current(false),
+      mesh_mapping("linear"),
+      mesh_mapping_parent(false),
+      mesh_mapping_diagnostic(false),
       num_method(0),
       method_courant_global(1.0),
       method_list(),
@@ -241,6 +276,7 @@ public: // interface
       method_flux_correct_group(),
       method_flux_correct_enable(),
       method_flux_correct_min_digits(),
+      method_overlap_refresh(),
       method_timestep(),
       method_trace_name(),
       method_null_dt(0.0),
@@ -272,6 +308,10 @@ public: // interface
       output_dir(),
       output_stride_write(),
       output_stride_wait(),
+      output_async(),
+      output_async_staging_mb(),
+      output_block_index(),
+      output_compress(),
       output_field_list(),
       output_particle_list(),
       output_name(),
@@ -298,6 +338,11 @@ public: // interface
       performance_warnings(false),
       performance_on_schedule_index(-1),
       performance_off_schedule_index(-1),
+      performance_trace_file(""),
+      performance_trace_format("csv"),
+      performance_timeline_cycles(),
+      performance_timeline_file(""),
+      performance_timeline_size(0),
       num_physics(0),
       physics_list(),
       restart_file(""),
@@ -370,6 +415,8 @@ public: // attributes
   // Balance (dynamic load balancing)
 
   int                        balance_schedule_index;
+  bool                       balance_cost_model;
+  double                     balance_cost_particle;
 
   // Boundary
 
@@ -397,6 +444,7 @@ public: // attributes
   int                        field_ghost_depth[3];
   int                        field_padding;
   int                        field_history;
+  std::vector<std::string>   field_history_list;
   int                        field_precision;
   std::string                field_prolong;
   std::string                field_restrict;
@@ -421,6 +469,9 @@ public: // attributes
   bool                       memory_active;
   double                     memory_warning_mb;
   double                     memory_limit_gb;
+  double                     memory_pool_limit_mb;
+  bool                       memory_buffer_pool;
+  double                     memory_buffer_limit_mb;
 
   // Mesh
 
@@ -430,6 +481,12 @@ public: // attributes
   int                        mesh_min_level;
   int                        mesh_max_level;
   int                        mesh_max_initial_level;
+  bool                       mesh_refresh_aggregate;
+  bool                       mesh_refresh_local_copy;
+  bool                       mesh_refresh_skip_current;
+  std::string                mesh_mapping;
+  bool                       mesh_mapping_parent;
+  bool                       mesh_mapping_diagnostic;
 
   // Method
 
@@ -444,6 +501,7 @@ public: // attributes
   std::vector<std::string>   method_flux_correct_group;
   std::vector<bool>          method_flux_correct_enable;
   std::vector<double>        method_flux_correct_min_digits;
+  std::vector<bool>          method_overlap_refresh;
   std::vector<double>        method_timestep;
   std::vector<std::string>   method_trace_name;
   double                     method_null_dt;
@@ -483,6 +541,10 @@ public: // attributes
   std::string                 output_dir_global;
   std::vector < int >         output_stride_write;
   std::vector < int >         output_stride_wait;
+  std::vector < char >        output_async;
+  std::vector < double >      output_async_staging_mb;
+  std::vector < char >        output_block_index;
+  std::vector < int >         output_compress;
   std::vector < std::vector <std::string> >  output_field_list;
   std::vector < std::vector <std::string> > output_particle_list;
   std::vector < std::vector <std::string> >  output_name;
@@ -520,6 +582,11 @@ public: // attributes
   bool                       performance_warnings;
   int                        performance_on_schedule_index;
   int                        performance_off_schedule_index;
+  std::string                performance_trace_file;
+  std::string                performance_trace_format;
+  std::vector<int>           performance_timeline_cycles;
+  std::string                performance_timeline_file;
+  int                        performance_timeline_size;
 
   // Physics
   
@@ -29,6 +29,7 @@ Performance::Performance (Config * config)
   region_started_(),
   region_index_(),
   region_in_charm_(),
+  region_depth_(),
 #ifdef CONFIG_USE_PAPI  
   papi_counters_(0),
 #endif
@@ -47,6 +48,10 @@ Performance::Performance (Config * config)
   new_counter(counter_type_abs,"bytes-high");
   new_counter(counter_type_abs,"bytes-highest");
   new_counter(counter_type_abs,"bytes-available");
+  new_counter(counter_type_abs,"bytes-pool");
+  new_counter(counter_type_abs,"bytes-buffers");
+  new_counter(counter_type_rel,"buffer-hits");
+  new_counter(counter_type_rel,"buffer-misses");
 
 #ifdef CONFIG_USE_PAPI  
   papi_.init();
@@ -105,6 +110,14 @@ Performance::new_counter ( int type, std::string  counter_name )
   counter_values_.push_back(0);
   counter_values_reduced_.push_back(0);
 
+  // regions created before begin() are sized by begin()
+
+  for (size_t i=0; i<region_counters_.size(); i++) {
+    if (region_counters_[i].size() > 0) {
+      region_counters_[i].resize(counter_name_.size());
+    }
+  }
+
 #ifdef CONFIG_USE_PAPI  
   if (type == counter_type_papi) {
     papi_.add_event(counter_name);
@@ -116,6 +129,43 @@ Performance::new_counter ( int type, std::string  counter_name )
 
 //----------------------------------------------------------------------
 
+int
+Performance::counter_index (std::string counter_name) const throw()
+{
+  for (size_t i=0; i<counter_name_.size(); i++) {
+    if (counter_name_[i] == counter_name) return i;
+  }
+  return -1;
+}
+
+//----------------------------------------------------------------------
+
+std::vector<int>
+Performance::user_counters (const std::vector<std::string> & names)
+{
+  std::vector<int> indices (names.size());
+  for (size_t i=0; i<names.size(); i++) {
+    indices[i] = counter_index(names[i]);
+    if (indices[i] < 0) {
+      indices[i] = new_counter(counter_type_user,names[i]);
+    }
+  }
+  return indices;
+}
+
+//----------------------------------------------------------------------
+
+void
+Performance::assign_counters (const std::vector<int> & indices,
+                              const std::vector<long long> & values)
+{
+  for (size_t i=0; i<indices.size(); i++) {
+    assign_counter(indices[i],values[i]);
+  }
+}
+
+//----------------------------------------------------------------------
+
 void
 Performance::refresh_counters_() throw()
 {
@@ -140,6 +190,10 @@ Performance::refresh_counters_() throw()
   counter_values_[perf_index_bytes_high]    = memory->bytes_high();
   counter_values_[perf_index_bytes_highest] = memory->bytes_highest();
   counter_values_[perf_index_bytes_available] = memory->bytes_available();
+  counter_values_[perf_index_bytes_pool]    = memory->bytes_pool();
+  counter_values_[perf_index_bytes_buffers] = memory->bytes_buffers();
+  counter_values_[perf_index_buffer_hits]   = memory->num_buffer_hits();
+  counter_values_[perf_index_buffer_misses] = memory->num_buffer_misses();
 
 }
 
@@ -214,6 +268,23 @@ Performance::new_region (int         region_index,
   std::vector <long long> counters;
   region_counters_.push_back(counters);
   region_started_.push_back(false);
+  region_depth_.push_back(0);
+}
+
+//----------------------------------------------------------------------
+
+int
+Performance::new_region (std::string region_name, bool in_charm) throw()
+{
+  const int region_index = region_name_.size();
+
+  new_region (region_index,region_name,in_charm);
+
+  // counters are sized by begin() for regions created before it
+
+  region_counters_[region_index].resize(num_counters());
+
+  return region_index;
 }
 
 //----------------------------------------------------------------------
@@ -238,6 +309,12 @@ Performance::start_region(int id_region, std::string file, int line) throw()
 
     region_started_[index_region] = true;
 
+    Tracer * tracer = Tracer::instance();
+    if (tracer->is_active()) {
+      tracer->begin_async
+        (tracer->name_id(region_name_[index_region]),index_region);
+    }
+
   } else if (warnings_) {
     if (file == "") {
       WARNING1 ("Performance::start_region",
@@ -281,6 +358,12 @@ Performance::stop_region(int id_region, std::string file, int line) throw()
 
     region_started_[index_region] = false;
 
+    Tracer * tracer = Tracer::instance();
+    if (tracer->is_active()) {
+      tracer->end_async
+        (tracer->name_id(region_name_[index_region]),index_region);
+    }
+
   } else if (warnings_) {
     if (file == "") {
       WARNING1 ("Performance::stop_region",
@@ -310,6 +393,27 @@ Performance::stop_region(int id_region, std::string file, int line) throw()
 
 //----------------------------------------------------------------------
 
+void
+Performance::enter_region(int index_region) throw()
+{
+  if (region_depth_[index_region]++ == 0) {
+    start_region(index_region);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void
+Performance::exit_region(int index_region) throw()
+{
+  if (region_depth_[index_region] > 0 &&
+      --region_depth_[index_region] == 0) {
+    stop_region(index_region);
+  }
+}
+
+//----------------------------------------------------------------------
+
 bool
 Performance::is_region_active(int index_region) throw()
 {
@@ -27,6 +27,10 @@ enum index_enum {
   perf_index_bytes_high,
   perf_index_bytes_highest,
   perf_index_bytes_available,
+  perf_index_bytes_pool,
+  perf_index_bytes_buffers,
+  perf_index_buffer_hits,
+  perf_index_buffer_misses,
   perf_index_last,
   num_perf_index = perf_index_last
 };
@@ -87,6 +91,7 @@ public: // interface
      region_started_(),
      region_index_(),
      region_in_charm_(),
+     region_depth_(),
 #ifdef CONFIG_USE_PAPI     
      papi_counters_(0),
 #endif
@@ -118,6 +123,7 @@ public: // interface
     p | region_started_;
     p | region_index_;
     p | region_in_charm_;
+    p | region_depth_;
 #ifdef CONFIG_USE_PAPI  
     WARNING("Performance::pup",
 	    "skipping Performance:papi_counters_");
@@ -137,9 +143,23 @@ public: // interface
   int num_counters() const throw() 
   { return counter_name_.size(); }
 
-  ///  	Create a new user counter.
+  ///  	Create a new user counter.  Counters may be created after
+  ///  	begin(), but must be created in the same order on all processes
   int new_counter(int counter_type, std::string counter_name);
 
+  /// Return the index of the given counter, or -1 if none
+  int counter_index (std::string counter_name) const throw();
+
+  /// Return the indices of the user counters with the given names,
+  /// creating any that do not exist.  Must be called in the same
+  /// order on all processes
+  std::vector<int> user_counters (const std::vector<std::string> & names);
+
+  /// Assign values to user counters, e.g. those returned by
+  /// user_counters()
+  void assign_counters (const std::vector<int> & indices,
+                        const std::vector<long long> & values);
+
   ///  	Return the value of a counter.
   long long counter(int index_counter) throw();
 
@@ -171,9 +191,13 @@ public: // interface
   /// Return whether the code region is outside the scope of Cello
   bool region_in_charm (std::string name) const throw();
 
-  /// Add a new region, returning the id
+  /// Add a new region with the given id
   void new_region(int index_region, std::string region, bool in_charm=false) throw();
 
+  /// Add a new region after all existing regions, returning its id.
+  /// Used for regions known only at run time, e.g. one per Method
+  int new_region(std::string region, bool in_charm=false) throw();
+
   /// Return whether performance monitoring is started for the region 
   bool is_region_active(int index_region) throw();
 
@@ -183,6 +207,13 @@ public: // interface
   /// Stop counters for a code region
   void stop_region(int index_region,  std::string file="", int line=0) throw();
 
+  /// Enter a code region that may be entered by several Blocks at
+  /// once: counters run while at least one Block is inside
+  void enter_region(int index_region) throw();
+
+  /// Exit a code region entered with enter_region()
+  void exit_region(int index_region) throw();
+
   /// Clear the counters for a code region
   void clear_region(int index_region) throw();
 
@@ -248,6 +279,9 @@ private: // attributes
   /// which regions are outside scope of Cello
   std::vector<char> region_in_charm_;
 
+  /// number of Blocks inside each region entered with enter_region()
+  std::vector<int> region_depth_;
+
 #ifdef CONFIG_USE_PAPI  
   /// Array for storing PAPI counter values
   long long * papi_counters_;
@@ -0,0 +1,92 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     performance_Tracer.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     Sat Oct 17 19:12:44 PDT 2026
+/// @brief    Implementation of the Tracer class
+
+#include "cello.hpp"
+
+#include "performance.hpp"
+
+Tracer Tracer::instance_[CONFIG_NODE_SIZE];
+
+//----------------------------------------------------------------------
+
+void Tracer::set_capacity (int capacity) throw()
+{
+  events_.resize(std::max(capacity,0));
+  clear();
+  if (events_.size() == 0) active_ = false;
+}
+
+//----------------------------------------------------------------------
+
+int Tracer::name_id (const std::string & name) throw()
+{
+  auto it = name_id_.find(name);
+  if (it != name_id_.end()) return it->second;
+
+  const int id = name_.size();
+  name_.push_back(name);
+  name_id_[name] = id;
+  return id;
+}
+
+//----------------------------------------------------------------------
+
+void Tracer::write (std::string file_name, bool is_first) const throw()
+{
+  FILE * fp = fopen (file_name.c_str(),"w");
+  if (fp == nullptr) {
+    WARNING1 ("Tracer::write()",
+              "Cannot open trace file %s",file_name.c_str());
+    return;
+  }
+
+  // processes are shown as threads of their node
+
+  const int pid = CkMyNode();
+  const int tid = CkMyPe();
+
+  if (is_first) fprintf (fp,"[\n");
+
+  fprintf (fp,"{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,"
+           "\"args\":{\"name\":\"PE %d\"}},\n",pid,tid,tid);
+  fprintf (fp,"{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,"
+           "\"args\":{\"sort_index\":%d}},\n",pid,tid,tid);
+
+  // oldest event is at index_next_ once the buffer has wrapped
+
+  const int n = events_.size();
+  const int i0 = (num_events_ < n) ? 0 : index_next_;
+
+  for (int k=0; k<num_events_; k++) {
+    const Event & event = events_[(i0 + k) % n];
+    const char * name = name_[event.name].c_str();
+    switch (event.phase) {
+    case 'B':
+    case 'E':
+      fprintf (fp,"{\"name\":\"%s\",\"cat\":\"entry\",\"ph\":\"%c\","
+               "\"ts\":%lld,\"pid\":%d,\"tid\":%d},\n",
+               name,event.phase,event.time,pid,tid);
+      break;
+    case 'b':
+    case 'e':
+      // async ids are per process so regions on different
+      // processes are not matched
+      fprintf (fp,"{\"name\":\"%s\",\"cat\":\"region\",\"ph\":\"%c\","
+               "\"id\":\"%d.%d\",\"ts\":%lld,\"pid\":%d,\"tid\":%d},\n",
+               name,event.phase,tid,event.arg,event.time,pid,tid);
+      break;
+    case 'i':
+      fprintf (fp,"{\"name\":\"%s\",\"cat\":\"message\",\"ph\":\"i\","
+               "\"s\":\"t\",\"ts\":%lld,\"pid\":%d,\"tid\":%d,"
+               "\"args\":{\"id\":%d}},\n",
+               name,event.time,pid,tid,event.arg);
+      break;
+    }
+  }
+
+  fclose (fp);
+}
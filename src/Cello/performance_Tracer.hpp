@@ -0,0 +1,189 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     performance_Tracer.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     Sat Oct 17 19:12:44 PDT 2026
+/// @brief    [\ref Performance] Declaration of the Tracer class
+///
+/// Tracer records timestamped events on each process in a fixed-size
+/// ring buffer, and writes them in the Chrome trace-event JSON format
+/// for viewing in chrome://tracing or https://ui.perfetto.dev.  Three
+/// kinds of events are recorded: entry methods marked with
+/// TRACER_ENTRY(), which nest on the process timeline; Performance
+/// regions, which may overlap and are shown as async slices; and
+/// instantaneous events such as refresh message sends and receives.
+/// Recording is off unless set_active(true) is called, so that
+/// inactive tracing costs only a test of a flag.
+
+#ifndef PERFORMANCE_TRACER_HPP
+#define PERFORMANCE_TRACER_HPP
+
+class Tracer {
+
+  /// @class    Tracer
+  /// @ingroup  Performance
+  /// @brief    [\ref Performance] Per-process event timeline
+
+public: // interface
+
+  /// Create an inactive Tracer with an empty buffer
+  Tracer() throw()
+    : events_(),
+      index_next_(0),
+      num_events_(0),
+      num_dropped_(0),
+      active_(false),
+      name_(),
+      name_id_()
+  { }
+
+  /// Return the Tracer for the current process
+  static Tracer * instance() throw()
+  { return & instance_[cello::index_static()]; }
+
+  /// Set the maximum number of events kept; older events are
+  /// overwritten when the buffer is full
+  void set_capacity (int capacity) throw();
+
+  /// Start or stop recording events
+  void set_active (bool active) throw()
+  { active_ = active && (events_.size() > 0); }
+
+  /// Whether events are being recorded
+  bool is_active() const throw()
+  { return active_; }
+
+  /// Return the id of the given event name, adding it if needed
+  int name_id (const std::string & name) throw();
+
+  /// Record the start of a nested event, e.g. an entry method
+  void begin (int id_name) throw()
+  { if (active_) record_(id_name,'B',0); }
+
+  /// Record the end of a nested event
+  void end (int id_name) throw()
+  { if (active_) record_(id_name,'E',0); }
+
+  /// Record the start of an event that may overlap others, e.g. a
+  /// Performance region; key matches it to its end_async()
+  void begin_async (int id_name, int key) throw()
+  { if (active_) record_(id_name,'b',key); }
+
+  /// Record the end of an event started with begin_async()
+  void end_async (int id_name, int key) throw()
+  { if (active_) record_(id_name,'e',key); }
+
+  /// Record an instantaneous event with an integer argument
+  void instant (int id_name, int arg) throw()
+  { if (active_) record_(id_name,'i',arg); }
+
+  /// Number of events in the buffer
+  int num_events() const throw()
+  { return num_events_; }
+
+  /// Number of events overwritten since the last clear()
+  long long num_dropped() const throw()
+  { return num_dropped_; }
+
+  /// Discard all recorded events
+  void clear() throw()
+  { index_next_ = 0; num_events_ = 0; num_dropped_ = 0; }
+
+  /// Write recorded events, oldest first, to the given file.  Files
+  /// written with is_first false omit the opening "[" so that files
+  /// from all processes may be concatenated into one trace
+  void write (std::string file_name, bool is_first) const throw();
+
+private: // functions
+
+  /// Append an event to the ring buffer
+  void record_ (int id_name, char phase, int arg) throw()
+  {
+    Event & event = events_[index_next_];
+    event.time  = time_usec_();
+    event.name  = id_name;
+    event.arg   = arg;
+    event.phase = phase;
+    if (++index_next_ == events_.size()) index_next_ = 0;
+    if (num_events_ < (int)events_.size()) ++num_events_;
+    else                                   ++num_dropped_;
+  }
+
+  /// Time in microseconds since the epoch, for alignment across nodes
+  static long long time_usec_ () throw()
+  {
+    struct timeval tv;
+    gettimeofday (&tv,NULL);
+    return (long long)(1000000) * tv.tv_sec + tv.tv_usec;
+  }
+
+private: // attributes
+
+  struct Event {
+    long long time;
+    int name;
+    int arg;
+    char phase;
+  };
+
+  /// Ring buffer of events
+  std::vector<Event> events_;
+
+  /// Position of the next event in events_
+  std::size_t index_next_;
+
+  /// Number of valid events in events_
+  int num_events_;
+
+  /// Number of events overwritten
+  long long num_dropped_;
+
+  /// Whether events are being recorded
+  bool active_;
+
+  /// Event names
+  std::vector<std::string> name_;
+
+  /// Index of each name in name_
+  std::map<std::string,int> name_id_;
+
+  /// Tracer for each process
+  static Tracer instance_[CONFIG_NODE_SIZE];
+};
+
+//----------------------------------------------------------------------
+
+class TracerEntry {
+
+  /// @class    TracerEntry
+  /// @ingroup  Performance
+  /// @brief    [\ref Performance] Records a Tracer begin and end event
+  /// for the enclosing scope
+
+public: // interface
+
+  TracerEntry (const char * name) throw()
+    : id_name_(-1)
+  {
+    Tracer * tracer = Tracer::instance();
+    if (tracer->is_active()) {
+      id_name_ = tracer->name_id(name);
+      tracer->begin(id_name_);
+    }
+  }
+
+  ~TracerEntry() throw()
+  {
+    if (id_name_ >= 0) Tracer::instance()->end(id_name_);
+  }
+
+private: // attributes
+
+  /// Event name id, or -1 if tracing was inactive on entry
+  int id_name_;
+};
+
+/// Record the enclosing entry method in the Tracer timeline
+#define TRACER_ENTRY(NAME) TracerEntry tracer_entry_(NAME)
+
+#endif /* PERFORMANCE_TRACER_HPP */
@@ -58,6 +58,11 @@ public: // virtual functions
     const Hierarchy  * hierarchy
     ) throw();
 
+  /// Called by each Block after all Blocks have been initialized, for
+  /// freeing data shared by Blocks during initialization
+  virtual void enforce_done() throw()
+  { }
+
   /// Return whether enforce() expects block != NULL
   virtual bool expects_blocks_allocated() const throw()
   { return true; }
@@ -14,7 +14,10 @@ double Method::courant_global = 1.0;
 Method::Method (double courant) throw()
   : schedule_(NULL),
     courant_(courant),
-    neighbor_type_(neighbor_leaf)
+    neighbor_type_(neighbor_leaf),
+    modifies_all_fields_(true),
+    modified_fields_(),
+    overlap_refresh_(false)
 {
   ir_post_ = add_new_refresh_();
   cello::refresh(ir_post_)->set_callback(CkIndex_Block::p_compute_continue());
@@ -37,6 +40,9 @@ void Method::pup (PUP::er &p)
   p | courant_;
   p | ir_post_;
   p | neighbor_type_;
+  p | modifies_all_fields_;
+  p | modified_fields_;
+  p | overlap_refresh_;
   p | required_fields_; // std::vector<str> required fields
   p | field_centering_; // std::map<std::string, std::array<int,3>>
 
@@ -75,6 +81,24 @@ void Method::set_schedule (Schedule * schedule) throw()
 
 //----------------------------------------------------------------------
 
+void Method::set_modified_fields (std::vector<std::string> field_list) throw()
+{
+  modifies_all_fields_ = false;
+  modified_fields_.clear();
+  FieldDescr * field_descr = cello::field_descr();
+  for (size_t i=0; i<field_list.size(); i++) {
+    const int id_field = field_descr->field_id(field_list[i]);
+    // field must already be defined; otherwise stay conservative
+    ASSERT1 ("Method::set_modified_fields()",
+             "Field \"%s\" must be defined before declaring it modified",
+             field_list[i].c_str(),
+             (id_field >= 0));
+    modified_fields_.push_back(id_field);
+  }
+}
+
+//----------------------------------------------------------------------
+
 void Method::define_fields () throw()
 {
   /* Ensure required fields are defined for this method */
@@ -33,7 +33,10 @@ public: // interface
     schedule_(NULL),
     courant_(1.0),
     ir_post_(-1),
-    neighbor_type_(neighbor_leaf)
+    neighbor_type_(neighbor_leaf),
+    modifies_all_fields_(true),
+    modified_fields_(),
+    overlap_refresh_(false)
 
   { }
 
@@ -46,6 +49,14 @@ public: // virtual functions
 
   virtual void compute ( Block * block) throw() = 0;
 
+  /// Optionally apply the method to cells that do not depend on ghost
+  /// zones while the Method's refresh is in progress.  Called only if
+  /// overlap_refresh() is true; must not modify fields in the
+  /// Method's refresh, and compute() is still called afterwards to
+  /// finish the update
+  virtual void compute_interior ( Block * block) throw()
+  { }
+
   /// Return the name of this Method
   virtual std::string name () throw () = 0;
 
@@ -86,6 +97,29 @@ public: // virtual functions
   void set_courant(double courant) throw ()
   { courant_ = courant; }
 
+  /// Declare the fields that compute() may write to.  By default a
+  /// Method is assumed to modify all fields; the list must be
+  /// conservative, since ghost zones of fields not in it may be
+  /// treated as current when Mesh:refresh_skip_current is true
+  void set_modified_fields (std::vector<std::string> field_list) throw();
+
+  /// Return whether compute() may write to the given field
+  bool modifies_field (int id_field) const throw()
+  {
+    return modifies_all_fields_ ||
+      (std::find (modified_fields_.begin(), modified_fields_.end(), id_field)
+       != modified_fields_.end());
+  }
+
+  /// Return whether compute_interior() is called while the Method's
+  /// refresh is in progress
+  bool overlap_refresh() const throw()
+  { return overlap_refresh_; }
+
+  /// Set whether to call compute_interior() during the Method's refresh
+  void set_overlap_refresh (bool overlap_refresh) throw()
+  { overlap_refresh_ = overlap_refresh; }
+
 protected: // functions
 
   /// Perform vector copy X <- Y
@@ -117,6 +151,15 @@ protected: // attributes
   /// Default refresh type
   int neighbor_type_;
 
+  /// Whether compute() may write to any field (default true)
+  bool modifies_all_fields_;
+
+  /// Field id's that compute() may write to if not modifies_all_fields_
+  std::vector<int> modified_fields_;
+
+  /// Whether to call compute_interior() during the Method's refresh
+  bool overlap_refresh_;
+
   /// List of fields required for the Method
   std::vector<std::string> required_fields_;
 
@@ -20,6 +20,9 @@ MethodTrace::MethodTrace
     timestep_(timestep),
     name_(name)
 {
+  // compute() only updates particle positions
+  set_modified_fields({});
+
   cello::simulation()->new_refresh_set_name(ir_post_,name);
   
   Refresh * refresh = cello::refresh(ir_post_);
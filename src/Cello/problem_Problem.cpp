@@ -459,6 +459,9 @@ void Problem::initialize_method ( Config * config ) throw()
 
       method_list_.push_back(method); 
 
+      method->set_overlap_refresh
+        (config->method_overlap_refresh[index_method]);
+
       int index_schedule = config->method_schedule_index[index_method];
 
       if (index_schedule != -1) {
@@ -945,6 +948,11 @@ Output * Problem::create_output_
     output = new OutputCheckpoint (index,factory,
 				   config,CkNumPes());
 
+  } else if (name == "data_shared") {
+
+    output = new OutputShared (index,factory,
+			       config,CkNumPes());
+
   }
 
   return output;
@@ -168,6 +168,9 @@ public: // interface
   /// proceed with next output
   void output_write (Simulation * simulation, int n, char * buffer) throw();
 
+  /// Complete deferred writes of all output objects on this process
+  void output_drain() throw();
+
   /// Return the stopping object
   Stopping * stopping() const throw() { return stopping_; }
 
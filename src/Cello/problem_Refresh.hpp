@@ -172,6 +172,15 @@ public: // interface
     field_list_dst_ = field_list;
   }
 
+  /// Replace the source and destination field lists
+  void set_field_list_src_dst (std::vector<int> field_list_src,
+                               std::vector<int> field_list_dst)
+  {
+    all_fields_ = false;
+    field_list_src_ = field_list_src;
+    field_list_dst_ = field_list_dst;
+  }
+
   /// Return whether all fields are refreshed
   bool all_fields() const
   { return all_fields_; }
@@ -61,7 +61,21 @@ Simulation::Simulation
   new_refresh_list_(),
   index_output_(-1),
   num_solver_iter_(),
-  max_solver_iter_()
+  max_solver_iter_(),
+  num_msg_refresh_aggregate_(0),
+  num_msg_refresh_saved_(0),
+  bytes_refresh_aggregate_(0),
+  bytes_refresh_saved_(0),
+  num_refresh_local_copy_(0),
+  num_refresh_skipped_(0),
+  num_refresh_fields_skipped_(0),
+  new_refresh_outbox_(),
+  new_refresh_flush_id_(-1),
+  perf_region_method_(),
+  perf_region_solver_(),
+  perf_region_time_(),
+  balance_id_(),
+  balance_v3_()
 {
   for (int i=0; i<256; i++) dir_checkpoint_[i] = '\0';
 #ifdef DEBUG_SIMULATION
@@ -126,7 +140,21 @@ Simulation::Simulation()
   new_refresh_list_(),
   index_output_(-1),
   num_solver_iter_(),
-  max_solver_iter_()
+  max_solver_iter_(),
+  num_msg_refresh_aggregate_(0),
+  num_msg_refresh_saved_(0),
+  bytes_refresh_aggregate_(0),
+  bytes_refresh_saved_(0),
+  num_refresh_local_copy_(0),
+  num_refresh_skipped_(0),
+  num_refresh_fields_skipped_(0),
+  new_refresh_outbox_(),
+  new_refresh_flush_id_(-1),
+  perf_region_method_(),
+  perf_region_solver_(),
+  perf_region_time_(),
+  balance_id_(),
+  balance_v3_()
 {
   for (int i=0; i<256; i++) dir_checkpoint_[i] = '\0';
 #ifdef DEBUG_SIMULATION
@@ -179,7 +207,21 @@ Simulation::Simulation (CkMigrateMessage *m)
     new_refresh_list_(),
     index_output_(-1),
     num_solver_iter_(),
-    max_solver_iter_()
+    max_solver_iter_(),
+    num_msg_refresh_aggregate_(0),
+    num_msg_refresh_saved_(0),
+    bytes_refresh_aggregate_(0),
+    bytes_refresh_saved_(0),
+    num_refresh_local_copy_(0),
+  num_refresh_skipped_(0),
+  num_refresh_fields_skipped_(0),
+  new_refresh_outbox_(),
+  new_refresh_flush_id_(-1),
+  perf_region_method_(),
+  perf_region_solver_(),
+  perf_region_time_(),
+  balance_id_(),
+  balance_v3_()
 {
   for (int i=0; i<256; i++) dir_checkpoint_[i] = '\0';
 #ifdef DEBUG_SIMULATION
@@ -295,6 +337,9 @@ void Simulation::pup (PUP::er &p)
   p | index_output_;
   p | num_solver_iter_;
   p | max_solver_iter_;
+  p | perf_region_method_;
+  p | perf_region_solver_;
+  p | perf_region_time_;
 }
 
 //----------------------------------------------------------------------
@@ -391,6 +436,9 @@ void Simulation::initialize_memory_() throw()
     memory->set_active(config_->memory_active);
     memory->set_warning_mb (config_->memory_warning_mb);
     memory->set_limit_gb (config_->memory_limit_gb);
+    memory->set_pool_limit_mb (config_->memory_pool_limit_mb);
+    memory->set_buffer_pool (config_->memory_buffer_pool);
+    memory->set_buffer_limit_mb (config_->memory_buffer_limit_mb);
   }
   
 }
@@ -468,6 +516,10 @@ void Simulation::initialize_performance_() throw()
   }
 #endif
 
+  if (config_->performance_timeline_cycles.size() > 0) {
+    Tracer::instance()->set_capacity(config_->performance_timeline_size);
+  }
+
   p->begin();
 
   p->start_region(perf_simulation);
@@ -476,6 +528,49 @@ void Simulation::initialize_performance_() throw()
 
 //----------------------------------------------------------------------
 
+void Simulation::initialize_performance_regions_() throw()
+{
+  // One region per Method and per Solver, created in the same order
+  // on all processes so region counters can be reduced
+
+  Performance * p = performance_;
+
+  perf_region_method_.clear();
+  for (int i=0; problem_->method(i); i++) {
+    perf_region_method_.push_back
+      (p->new_region("method_" + problem_->method(i)->name()));
+  }
+
+  perf_region_solver_.clear();
+  for (int i=0; i<problem_->num_solvers(); i++) {
+    perf_region_solver_.push_back
+      (p->new_region("solver_" + problem_->solver(i)->name()));
+  }
+
+  perf_region_time_.assign
+    (perf_region_method_.size() + perf_region_solver_.size(), 0);
+
+  // Start a new trace file, replacing any from a previous run
+
+  if (CkMyPe() == 0 && config_->performance_trace_file != "") {
+    FILE * fp = fopen (config_->performance_trace_file.c_str(),"w");
+    if (fp == nullptr) {
+      WARNING1 ("Simulation::initialize_performance_regions_()",
+                "Cannot open performance trace file %s",
+                config_->performance_trace_file.c_str());
+    } else {
+      if (config_->performance_trace_format == "csv") {
+        fprintf (fp,"cycle,time,region,"
+                 "time-usec-min,time-usec-mean,time-usec-max,"
+                 "time-usec-stddev\n");
+      }
+      fclose (fp);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
 void Simulation::initialize_config_() throw()
 {
   TRACE("BEGIN Simulation::initialize_config_");
@@ -543,6 +638,7 @@ void Simulation::initialize_data_descr_() throw()
   
   field_descr_->set_padding (config_->field_padding);
 
+  field_descr_->set_history_list (config_->field_history_list);
   field_descr_->set_history (config_->field_history);
 
   for (int i=0; i<field_descr_->field_count(); i++) {
@@ -886,12 +982,22 @@ void Simulation::monitor_performance()
 
   // 0 num_sum
   // 1 num_max
+  // 1a num_sum_double
   // 2 msg_coarsen
   // 3 msg_refine
   // 4 msg_refresh
   // 5 data_msg
   // 6 field_face
   // 7 particle_data
+  // 7a msg_refresh_aggregate
+  // 7b msg_refresh_saved
+  // 7c bytes_refresh_aggregate
+  // 7d bytes_refresh_saved
+  // 7e refresh_local_copy
+  // 7f num_edges
+  // 7g num_edges_cut
+  // 7h refresh_skipped
+  // 7i refresh_fields_skipped
   // 8 num-particles
   // 9+ num_solver_iters
   // NL+ num-blocks-<L>
@@ -901,10 +1007,18 @@ void Simulation::monitor_performance()
   // 13+ max_node_blocks
   // 14+ max_node_particles
   // 15+ max_solver_iters
+  // 16+ max_proc_edges_cut
+  // 17+ method and solver region time-usec max and -min
+  // 18+ method and solver region time-usec squared (double)
   
   const int num_solver = problem()->num_solvers();
 
-  int n = 14 + 2*num_solver + ( hierarchy_->max_level() - hierarchy_->min_level() + 1) + nr*nc;
+  // method and solver regions report per-process time since the last
+  // call, including time squared for the standard deviation
+  const int nd = perf_region_time_.size();
+
+  int n = 25 + 2*num_solver + ( hierarchy_->max_level() - hierarchy_->min_level() + 1) + nr*nc
+    + 4*nd;
 
   
   long long * counters_region = new long long [nc];
@@ -912,11 +1026,21 @@ void Simulation::monitor_performance()
 
   const int in = cello::index_static();
 
+  // neighbor pairs split across processes are only counted when
+  // requested, since it requires visiting all leaf Block neighbors
+
+  long long num_edges = 0, num_edges_cut = 0;
+  if (config_->mesh_mapping_diagnostic) {
+    mapping_edge_cut_(&num_edges,&num_edges_cut);
+  }
+
   
   int m=0;
-  const int num_max = 4 + num_solver;
-  counters_reduce[m++] = n - num_max - 2;
+  const int num_max = 5 + num_solver + 2*nd;
+  const int num_sum_double = nd;
+  counters_reduce[m++] = n - num_max - num_sum_double - 3;
   counters_reduce[m++] = num_max;
+  counters_reduce[m++] = num_sum_double;
   
   // accumulated metrics
   
@@ -926,6 +1050,15 @@ void Simulation::monitor_performance()
   counters_reduce[m++] = DataMsg::counter[in];        // 5
   counters_reduce[m++] = FieldFace::counter[in];      // 6
   counters_reduce[m++] = ParticleData::counter[in];   // 7
+  counters_reduce[m++] = num_msg_refresh_aggregate_;  // 7a
+  counters_reduce[m++] = num_msg_refresh_saved_;      // 7b
+  counters_reduce[m++] = bytes_refresh_aggregate_;    // 7c
+  counters_reduce[m++] = bytes_refresh_saved_;        // 7d
+  counters_reduce[m++] = num_refresh_local_copy_;     // 7e
+  counters_reduce[m++] = num_edges;                   // 7f
+  counters_reduce[m++] = num_edges_cut;               // 7g
+  counters_reduce[m++] = num_refresh_skipped_;        // 7h
+  counters_reduce[m++] = num_refresh_fields_skipped_; // 7i
   counters_reduce[m++] = hierarchy_->num_particles(); // 8
   for (int i=0; i<num_solver; i++) {
     counters_reduce[m++] = cello::simulation()->get_solver_num_iter(i); // 9
@@ -948,6 +1081,17 @@ void Simulation::monitor_performance()
     }
   }
 
+  // method and solver region time since last call
+
+  std::vector<long long> time_region (nd);
+  for (int id = 0; id < nd; id++) {
+    const int ir = perf_region_dynamic_(id);
+    performance_->region_counters(ir,counters_region);
+    time_region[id] = counters_region[perf_index_time] - perf_region_time_[id];
+    perf_region_time_[id] = counters_region[perf_index_time];
+    counters_reduce[m++] = time_region[id];
+  }
+
   // maximum metrics
   
   counters_reduce[m++] = num_blocks_total;            // 11  max_proc_blocks
@@ -957,6 +1101,18 @@ void Simulation::monitor_performance()
   for (int i=0; i<num_solver; i++) {
     counters_reduce[m++] = cello::simulation()->get_solver_max_iter(i); // 15 max_node_particles
   }
+  counters_reduce[m++] = num_edges_cut;               // 16 max_proc_edges_cut
+  for (int id = 0; id < nd; id++) {
+    counters_reduce[m++] =  time_region[id];          // 17 max
+    counters_reduce[m++] = -time_region[id];          // 17 -min
+  }
+
+  // time squared is summed as double, since usec^2 may overflow long
+  // long and coarser units round short intervals to zero
+  for (int id = 0; id < nd; id++) {
+    const double time_sq = 1.0*time_region[id]*time_region[id];
+    memcpy (&counters_reduce[m++], &time_sq, sizeof(double)); // 18
+  }
 
   ASSERT2("Simulation::monitor_performance()",
 	  "Actual array length %d != expected array length %d", m,n,
@@ -982,6 +1138,39 @@ void Simulation::monitor_performance()
 
 //----------------------------------------------------------------------
 
+void Simulation::mapping_edge_cut_
+(long long * num_edges, long long * num_edges_cut)
+{
+  (*num_edges) = 0;
+  (*num_edges_cut) = 0;
+
+  CkLocMgr * loc_mgr = hierarchy_->block_array().ckLocMgr();
+
+  const int min_level = config_->mesh_min_level;
+  const int ip = CkMyPe();
+
+  for (size_t ib=0; ib<hierarchy_->num_blocks(); ib++) {
+
+    Block * block = hierarchy_->block(ib);
+
+    if (! block->is_leaf()) continue;
+
+    ItNeighbor it_neighbor =
+      block->it_neighbor(0,block->index(),neighbor_leaf,min_level,0);
+
+    int if3[3];
+    while (it_neighbor.next(if3)) {
+      const Index index_neighbor = it_neighbor.index();
+      ++(*num_edges);
+      if (loc_mgr->lastKnown(CkArrayIndexIndex(index_neighbor)) != ip) {
+        ++(*num_edges_cut);
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
 void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
 {
   long long * counters_reduce = (long long *)msg->getData();
@@ -991,12 +1180,22 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
   int m = 0;
   const int num_sum = counters_reduce[m++];             // 0
   const int num_max = counters_reduce[m++];             // 1
+  const int num_sum_double = counters_reduce[m++];      // 1a
   const long long msg_coarsen = counters_reduce[m++];   // 2
   const long long msg_refine  = counters_reduce[m++];   // 3
   const long long msg_refresh = counters_reduce[m++];   // 4
   const long long data_msg    = counters_reduce[m++];   // 5
   const long long field_face  = counters_reduce[m++];   // 6
   const long long particle_data = counters_reduce[m++]; // 7
+  const long long msg_refresh_aggregate   = counters_reduce[m++]; // 7a
+  const long long msg_refresh_saved       = counters_reduce[m++]; // 7b
+  const long long bytes_refresh_aggregate = counters_reduce[m++]; // 7c
+  const long long bytes_refresh_saved     = counters_reduce[m++]; // 7d
+  const long long refresh_local_copy      = counters_reduce[m++]; // 7e
+  const long long num_edges               = counters_reduce[m++]; // 7f
+  const long long num_edges_cut           = counters_reduce[m++]; // 7g
+  const long long refresh_skipped         = counters_reduce[m++]; // 7h
+  const long long refresh_fields_skipped  = counters_reduce[m++]; // 7i
   const long long num_particles = counters_reduce[m++]; // 8
 
   const int num_solver = problem()->num_solvers();
@@ -1013,6 +1212,30 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
   monitor()->print("Performance","counter num-data-msg %lld", data_msg);
   monitor()->print("Performance","counter num-field-face %lld", field_face);
   monitor()->print("Performance","counter num-particle-data %lld", particle_data);
+  if (config_->mesh_refresh_aggregate) {
+    monitor()->print("Performance","counter num-msg-refresh-aggregate %lld",
+                     msg_refresh_aggregate);
+    monitor()->print("Performance","counter num-msg-refresh-saved %lld",
+                     msg_refresh_saved);
+    monitor()->print("Performance","counter bytes-refresh-aggregate %lld",
+                     bytes_refresh_aggregate);
+    monitor()->print("Performance","counter bytes-refresh-saved %lld",
+                     bytes_refresh_saved);
+  }
+  clear_refresh_aggregate_stats();
+  if (config_->mesh_refresh_local_copy) {
+    monitor()->print("Performance","counter num-refresh-local-copy %lld",
+                     refresh_local_copy);
+  }
+  num_refresh_local_copy_ = 0;
+  if (config_->mesh_refresh_skip_current) {
+    monitor()->print("Performance","counter num-refresh-skipped %lld",
+                     refresh_skipped);
+    monitor()->print("Performance","counter num-refresh-fields-skipped %lld",
+                     refresh_fields_skipped);
+  }
+  num_refresh_skipped_ = 0;
+  num_refresh_fields_skipped_ = 0;
 
   monitor()->print("Performance","simulation num-particles total %lld",
 		   num_particles);
@@ -1051,11 +1274,14 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
   const int num_regions  = performance_->num_regions();
   const int num_counters =  performance_->num_counters();
 
+  // absolute and user counters are only reported for the cycle region
+
   for (int ir = 0; ir < num_regions; ir++) {
     for (int ic = 0; ic < num_counters; ic++, m++) {
+      const int type = performance_->counter_type(ic);
       bool do_print =
 	(ir != perf_unknown) && (
-	(performance_->counter_type(ic) != counter_type_abs) ||
+	(type != counter_type_abs && type != counter_type_user) ||
 	(ir == index_region_cycle));
       if (do_print) {
 	monitor()->print("Performance","%s %s %lld",
@@ -1067,6 +1293,12 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
     }
   }
 
+  const int nd = perf_region_time_.size();
+  std::vector<long long> time_region_sum (nd);
+  for (int id = 0; id < nd; id++) {
+    time_region_sum[id] = counters_reduce[m++];
+  }
+
   const long long max_proc_blocks    = counters_reduce[m++]; // 11
   const long long max_proc_particles = counters_reduce[m++]; // 12
   const long long max_node_blocks    = counters_reduce[m++]; // 13
@@ -1080,6 +1312,43 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
   }
   cello::simulation()->clear_solver_iter(); // clear it for the next solve
 
+  const long long max_proc_edges_cut = counters_reduce[m++]; // 16
+
+  // method and solver time per process since the last output
+
+  const int np = CkNumPes();
+  std::vector<long long> time_region_max (nd);
+  std::vector<long long> time_region_min (nd);
+  for (int id = 0; id < nd; id++) {
+    time_region_max[id] =  counters_reduce[m++]; // 17
+    time_region_min[id] = -counters_reduce[m++]; // 17
+  }
+  std::vector<double> time_region_sum_sq (nd);
+  for (int id = 0; id < nd; id++) {
+    memcpy (&time_region_sum_sq[id], &counters_reduce[m++], sizeof(double)); // 18
+  }
+
+  std::vector<double> time_region_stats (4*nd);
+  for (int id = 0; id < nd; id++) {
+    const long long time_max = time_region_max[id];
+    const long long time_min = time_region_min[id];
+    const double mean = 1.0*time_region_sum[id]/np;
+    const double var = time_region_sum_sq[id]/np - mean*mean;
+    const double stddev = sqrt(std::max(0.0,var));
+    time_region_stats[4*id+0] = time_min;
+    time_region_stats[4*id+1] = mean;
+    time_region_stats[4*id+2] = time_max;
+    time_region_stats[4*id+3] = stddev;
+    monitor()->print
+      ("Performance","%s time-usec-proc min %lld mean %.0f max %lld stddev %.0f",
+       performance_->region_name(perf_region_dynamic_(id)).c_str(),
+       time_min, mean, time_max, stddev);
+  }
+
+  if (CkMyPe() == 0 && config_->performance_trace_file != "") {
+    write_performance_trace_(time_region_stats);
+  }
+
   
   monitor()->print
     ("Performance","simulation max-proc-blocks %lld",  max_proc_blocks);
@@ -1109,8 +1378,38 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
     ("Performance","simulation balance-eff-blocks-node %f (%.0f/%lld)",
      avg_node_blocks / max_node_blocks,
      avg_node_blocks, max_node_blocks);
+
+  // process load before and after the last CelloLB load balancing step
+
+  if (CelloLB::num_steps() > 0) {
+    const double load_avg = CelloLB::load_avg();
+    const double load_max_before = CelloLB::load_max_before();
+    const double load_max_after  = CelloLB::load_max_after();
+    monitor()->print
+      ("Performance","simulation balance-eff-load-before %f (%g/%g)",
+       load_max_before > 0.0 ? load_avg / load_max_before : 1.0,
+       load_avg, load_max_before);
+    monitor()->print
+      ("Performance","simulation balance-eff-load-after %f (%g/%g)",
+       load_max_after > 0.0 ? load_avg / load_max_after : 1.0,
+       load_avg, load_max_after);
+  }
   
 
+  // neighbor pairs split across processes by the Block mapping
+
+  if (config_->mesh_mapping_diagnostic) {
+    const double avg_proc_edges_cut = 1.0*num_edges_cut/CkNumPes();
+    monitor()->print
+      ("Performance","simulation mapping-edges %lld", num_edges);
+    monitor()->print
+      ("Performance","simulation mapping-edges-cut %lld (%f)",
+       num_edges_cut, num_edges ? 1.0*num_edges_cut/num_edges : 0.0);
+    monitor()->print
+      ("Performance","simulation mapping-edges-cut-proc %.0f/%lld",
+       avg_proc_edges_cut, max_proc_edges_cut);
+  }
+
   if (num_particles > 0) {
     const double avg_proc_particles = 1.0*num_particles/CkNumPes();
     const double avg_node_particles = 1.0*num_particles/CkNumNodes();
@@ -1124,13 +1423,126 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
        avg_node_particles , max_node_particles );
   }
   
-  ASSERT3("Simulation::monitor_performance()",
-	  "Actual array length %d != expected array length 2 + %d + %d",
-	  m,num_sum,num_max,
-	  (m == 2+num_sum+num_max) );
+  ASSERT4("Simulation::monitor_performance()",
+	  "Actual array length %d != expected array length 3 + %d + %d + %d",
+	  m,num_sum,num_max,num_sum_double,
+	  (m == 3+num_sum+num_max+num_sum_double) );
 
   delete msg;
 
   Memory::instance()->reset_high();
 
 }
+
+//----------------------------------------------------------------------
+
+void Simulation::update_timeline() throw()
+{
+  Tracer * tracer = Tracer::instance();
+
+  // write the previous cycle's events if it was recorded
+
+  if (tracer->is_active()) {
+    tracer->set_active(false);
+    char file_name[256];
+    snprintf (file_name,sizeof(file_name),"%s-%05d-%05d.json",
+              config_->performance_timeline_file.c_str(),
+              cycle_ - 1, CkMyPe());
+    tracer->write(file_name, CkMyPe() == 0);
+    if (tracer->num_dropped() > 0) {
+      WARNING3 ("Simulation::update_timeline()",
+                "%lld oldest events in %s were dropped: "
+                "increase Performance:timeline:size above %d",
+                tracer->num_dropped(),file_name,
+                config_->performance_timeline_size);
+    }
+    tracer->clear();
+  }
+
+  // record this cycle if requested
+
+  const std::vector<int> & cycles = config_->performance_timeline_cycles;
+  if (std::find(cycles.begin(),cycles.end(),cycle_) != cycles.end()) {
+    if (CkMyPe() == 0) {
+      monitor()->print ("Performance","recording timeline for cycle %d",
+                        cycle_);
+    }
+    tracer->set_active(true);
+  }
+}
+
+//----------------------------------------------------------------------
+
+int Simulation::perf_region_dynamic_(int id) const throw()
+{
+  const int nm = perf_region_method_.size();
+  return (id < nm) ? perf_region_method_[id] : perf_region_solver_[id-nm];
+}
+
+//----------------------------------------------------------------------
+
+void Simulation::write_performance_trace_
+(const std::vector<double> & stats) throw()
+{
+  const std::string & file_name = config_->performance_trace_file;
+  FILE * fp = fopen (file_name.c_str(),"a");
+  if (fp == nullptr) {
+    WARNING1 ("Simulation::write_performance_trace_()",
+              "Cannot open performance trace file %s",
+              file_name.c_str());
+    return;
+  }
+
+  const int nd = perf_region_time_.size();
+
+  if (config_->performance_trace_format == "json") {
+    // one JSON object per line
+    fprintf (fp,"{\"cycle\": %d, \"time\": %.17g, \"regions\": {",
+             cycle_,time_);
+    for (int id = 0; id < nd; id++) {
+      fprintf (fp,"%s\"%s\": {\"time-usec-min\": %.0f, "
+               "\"time-usec-mean\": %.0f, \"time-usec-max\": %.0f, "
+               "\"time-usec-stddev\": %.0f}",
+               (id > 0) ? ", " : "",
+               performance_->region_name(perf_region_dynamic_(id)).c_str(),
+               stats[4*id+0],stats[4*id+1],stats[4*id+2],stats[4*id+3]);
+    }
+    fprintf (fp,"}}\n");
+  } else {
+    for (int id = 0; id < nd; id++) {
+      fprintf (fp,"%d,%.17g,%s,%.0f,%.0f,%.0f,%.0f\n",
+               cycle_,time_,
+               performance_->region_name(perf_region_dynamic_(id)).c_str(),
+               stats[4*id+0],stats[4*id+1],stats[4*id+2],stats[4*id+3]);
+    }
+  }
+
+  fclose (fp);
+}
+
+//----------------------------------------------------------------------
+
+void Simulation::balance_set_index (CmiUInt8 id, Index index)
+{
+  int v3[3];
+  index.values(v3);
+  balance_id_.push_back(id);
+  balance_v3_.insert(balance_v3_.end(),v3,v3+3);
+
+  // send once all Blocks on this process are recorded; quiescence
+  // before AtSync() ensures CelloLB receives it before work()
+
+  if (balance_id_.size() >= hierarchy_->num_blocks()) {
+    const int n = balance_id_.size();
+    proxy_simulation[0].p_balance_set_index (n, &balance_id_[0], &balance_v3_[0]);
+    balance_id_.clear();
+    balance_v3_.clear();
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Simulation::p_balance_set_index (int n, CmiUInt8 id[], int v3[])
+{
+  CelloLB::set_index (n,id,v3);
+}
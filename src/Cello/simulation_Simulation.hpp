@@ -121,6 +121,18 @@ public: // interface
   Performance * performance() throw()
   { return performance_; }
 
+  /// Start or stop recording the event timeline for
+  /// Performance:timeline:cycles at the start of each cycle
+  void update_timeline() throw();
+
+  /// Return the performance region of the given Method
+  int perf_region_method (int index_method) const throw()
+  { return perf_region_method_.at(index_method); }
+
+  /// Return the performance region of the given Solver
+  int perf_region_solver (int index_solver) const throw()
+  { return perf_region_solver_.at(index_solver); }
+
   /// Return the monitor object
   Monitor * monitor() const throw()
   { return monitor_; }
@@ -261,6 +273,10 @@ public: // virtual functions
   void output_start (int index_output);
   void output_exit();
 
+  /// Complete deferred output on all processes before exiting
+  void p_output_drain ();
+  void r_output_drain (CkReductionMsg * msg);
+
   /// Reduce output, using p_output_write to send data to writing processes
   void s_write()
   {
@@ -401,6 +417,63 @@ public: // virtual functions
   int new_refresh_count() const
   { return new_refresh_list_.size(); }
 
+  /// Receive refresh messages from a Block on another process that
+  /// were combined into a single message, and deliver them to the
+  /// destination Blocks
+  void p_new_refresh_recv_aggregate (MsgRefreshAggregate * msg);
+
+  /// Hold a refresh message from a Block on this process to the Block
+  /// with the given index on remote process ip, to be sent combined
+  /// with other messages to ip when this process next goes idle
+  void new_refresh_hold (int ip, Index index, MsgRefresh * msg);
+
+  /// Send all held refresh messages, one message per destination
+  /// process
+  void new_refresh_flush ();
+
+  /// Update statistics for an aggregate refresh message containing
+  /// num_msg MsgRefresh messages
+  void new_refresh_aggregate_stats (int num_msg, long long bytes,
+                                    long long bytes_saved)
+  {
+    ++num_msg_refresh_aggregate_;
+    num_msg_refresh_saved_   += (num_msg - 1);
+    bytes_refresh_aggregate_ += bytes;
+    bytes_refresh_saved_     += bytes_saved;
+  }
+
+  /// Clear refresh aggregation statistics
+  void clear_refresh_aggregate_stats()
+  {
+    num_msg_refresh_aggregate_ = 0;
+    num_msg_refresh_saved_ = 0;
+    bytes_refresh_aggregate_ = 0;
+    bytes_refresh_saved_ = 0;
+  }
+
+  /// Update statistics for a field face copied directly to a Block on
+  /// the same process instead of being sent in a MsgRefresh
+  void new_refresh_local_copy_stats()
+  { ++num_refresh_local_copy_; }
+
+  /// Update statistics for a refresh whose ghost zones were already
+  /// current: num_fields fields were dropped from the refresh, and
+  /// the whole refresh was skipped if skipped is true
+  void new_refresh_skip_stats(int num_fields, bool skipped)
+  {
+    num_refresh_fields_skipped_ += num_fields;
+    if (skipped) ++num_refresh_skipped_;
+  }
+
+  /// Record the Index of a Block on this process for CelloLB, and
+  /// send the Indices of all Blocks on this process to CelloLB on
+  /// process 0 once every Block has been recorded
+  void balance_set_index (CmiUInt8 id, Index index);
+
+  /// Receive the load balancing object id and Index of Blocks on
+  /// another process
+  void p_balance_set_index (int n, CmiUInt8 id[], int v3[]);
+
 protected: // functions
 
   /// Initialize the Config object
@@ -418,6 +491,15 @@ protected: // functions
   /// Initialize performance objects
   void initialize_performance_ () throw();
 
+  /// Create performance regions for each Method and Solver
+  void initialize_performance_regions_ () throw();
+
+  /// Return the region of the id'th Method then Solver
+  int perf_region_dynamic_ (int id) const throw();
+
+  /// Append Method and Solver time statistics to the performance trace
+  void write_performance_trace_ (const std::vector<double> & stats) throw();
+
   /// Initialize output Monitor object
   void initialize_monitor_ () throw();
 
@@ -435,6 +517,10 @@ protected: // functions
 
   void deallocate_() throw();
 
+  /// Count neighbor pairs of leaf Blocks on this process, and the
+  /// number whose neighbor was last known to be on another process
+  void mapping_edge_cut_ (long long * num_edges, long long * num_edges_cut);
+
   Schedule * create_schedule_(std::string var,
 			      std::string type,
 			      double start,
@@ -455,6 +541,10 @@ protected: // functions
     }
   }
 
+  /// Called by the Converse scheduler when the processor goes idle
+  /// after new_refresh_hold()
+  static void new_refresh_flush_idle_ (void * simulation, double time);
+
 protected: // attributes
 
 #if defined(CELLO_DEBUG) || defined(CELLO_VERBOSE)
@@ -565,6 +655,44 @@ protected: // attributes
   std::vector<int> num_solver_iter_;
   /// Max of solver iterations over blocks for solver i
   std::vector<int> max_solver_iter_;
+
+  /// Number of aggregate refresh messages sent since last performance
+  /// output
+  long long num_msg_refresh_aggregate_;
+  /// Number of MsgRefresh messages not sent due to aggregation
+  long long num_msg_refresh_saved_;
+  /// Total bytes sent in aggregate refresh messages
+  long long bytes_refresh_aggregate_;
+  /// Estimated message header bytes saved due to aggregation
+  long long bytes_refresh_saved_;
+  /// Number of field faces copied directly to Blocks on this process
+  long long num_refresh_local_copy_;
+  /// Number of refreshes skipped since all ghost zones were current
+  long long num_refresh_skipped_;
+  /// Number of fields dropped from refreshes since their ghost zones
+  /// were current
+  long long num_refresh_fields_skipped_;
+
+  /// Outgoing refresh messages from all Blocks on this process held
+  /// for aggregation, keyed by destination process
+  std::map < int, std::vector < std::pair<Index,MsgRefresh *> > >
+  new_refresh_outbox_;
+  /// Id of the pending new_refresh_flush_idle_() callback, or -1
+  int new_refresh_flush_id_;
+
+  /// Performance region of each Method
+  std::vector<int> perf_region_method_;
+  /// Performance region of each Solver
+  std::vector<int> perf_region_solver_;
+  /// Time in each Method then Solver region at the last performance
+  /// output, for computing time per interval
+  std::vector<long long> perf_region_time_;
+
+  /// Load balancing object id of Blocks recorded by
+  /// balance_set_index()
+  std::vector<CmiUInt8> balance_id_;
+  /// Index values of Blocks recorded by balance_set_index()
+  std::vector<int> balance_v3_;
 };
 
 #endif /* SIMULATION_SIMULATION_HPP */
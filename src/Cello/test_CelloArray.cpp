@@ -1092,6 +1092,56 @@ public:
 
 //----------------------------------------------------------------------
 
+class LeadingSubarrayTests{
+
+public:
+
+  template<template<typename, std::size_t> class Builder>
+  void test_leading_subarray_(){
+    std::string func_name = "LeadingSubarrayTests::test_leading_subarray_";
+    Builder<double, 3> builder(3,2,3);
+    CelloArray<double, 3> *arr_ptr = builder.get_arr();
+    for (int iz=0; iz<3; iz++){
+      for (int iy=0; iy<2; iy++){
+        for (int ix=0; ix<3; ix++){
+          (*arr_ptr)(iz,iy,ix) = 100*iz + 10*iy + ix;
+        }
+      }
+    }
+
+    CelloArray<double, 2> view = arr_ptr->leading_subarray(1);
+    check_arr_vals(view, std::vector<double>({100, 101, 102,
+                                              110, 111, 112}),
+                   func_name);
+
+    // the view shares data with the original array
+    view(1,2) = -7;
+    ASSERT("LeadingSubarrayTests::test_leading_subarray_",
+           "the view doesn't share data with the original array",
+           (*arr_ptr)(1,1,2) == -7);
+
+    // the view of a subarray uses the subarray's strides
+    CelloArray<double, 3> sub = arr_ptr->subarray(CSlice(1,3), CSlice(0,2),
+                                                  CSlice(1,3));
+    CelloArray<double, 2> sub_view = sub.leading_subarray(1);
+    check_arr_vals(sub_view, std::vector<double>({201, 202,
+                                                  211, 212}),
+                   func_name);
+    ASSERT("LeadingSubarrayTests::test_leading_subarray_",
+           "The arrays are aliases.",
+           sub_view.is_alias(arr_ptr->leading_subarray(2).subarray
+                             (CSlice(0,2), CSlice(1,3))));
+  }
+
+  void run_tests(){
+    test_leading_subarray_<MemManagedArrayBuilder>();
+    test_leading_subarray_<PtrWrapArrayBuilder>();
+  }
+
+};
+
+//----------------------------------------------------------------------
+
 PARALLEL_MAIN_BEGIN
 {
   PARALLEL_INIT;
@@ -1121,6 +1171,9 @@ PARALLEL_MAIN_BEGIN
   IsAliasTests is_alias_tests;
   is_alias_tests.run_tests();
 
+  LeadingSubarrayTests leading_subarray_tests;
+  leading_subarray_tests.run_tests();
+
   unit_finalize();
 
   exit_();
@@ -947,6 +947,102 @@ PARALLEL_MAIN_BEGIN
     delete field.field_data();
   }
 
+  //----------------------------------------------------------------------
+  // Selective history
+  //----------------------------------------------------------------------
+  {
+    unit_class("FieldData");
+
+    const int nx=4, ny=5, nz=6;
+    FieldDescr * field_descr = new FieldDescr;
+    FieldData * field_data = new FieldData(field_descr, nx,ny,nz);
+
+    Field field(field_descr,field_data);
+
+    int i1 = field.insert_permanent("f1");
+    int i2 = field.insert_permanent("f2");
+
+    field.set_precision(i1, precision_double);
+    field.set_precision(i2, precision_double);
+
+    unit_func("set_history_list");
+
+    field_descr->set_history_list(std::vector<std::string> {"f2"});
+    field.set_history (2);
+
+    unit_assert (! field.has_history(i1));
+    unit_assert (field.has_history("f2"));
+    unit_assert (field_descr->history_id(i1,1) == -1);
+    unit_assert (field.num_temporary() == 2);
+
+    field.allocate_permanent(true);
+
+    double * v1 = (double *) field.values(i1);
+    double * v2 = (double *) field.values(i2);
+    const int m = nx*ny*nz;
+
+    for (int i=0; i<m; i++) { v1[i] = 1.0*i; v2[i] = 2.0*i; }
+    field.save_history(1.0);
+    for (int i=0; i<m; i++) { v1[i] = 3.0*i; v2[i] = 4.0*i; }
+    field.save_history(2.0);
+
+    unit_func("save_history");
+
+    unit_assert (field.values(i1,1) == NULL);
+    unit_assert (field.values(i1,2) == NULL);
+
+    const double * v2h1 = (const double *) field.values(i2,1);
+    const double * v2h2 = (const double *) field.values(i2,2);
+    bool passed = (v2h1 != NULL) && (v2h2 != NULL);
+    for (int i=0; passed && i<m; i++) {
+      passed = (v2h1[i] == 4.0*i) && (v2h2[i] == 2.0*i);
+    }
+    unit_assert (passed);
+    unit_assert (field.history_time(1) == 2.0);
+
+    delete field.field_descr();
+    delete field.field_data();
+  }
+
+  //----------------------------------------------------------------------
+  // Rebuilding history reuses existing temporaries
+  //----------------------------------------------------------------------
+  {
+    unit_class("FieldDescr");
+
+    FieldDescr * field_descr = new FieldDescr;
+
+    int i1 = field_descr->insert_permanent("f1");
+    int i2 = field_descr->insert_permanent("f2");
+
+    field_descr->set_history_list(std::vector<std::string> {"f2"});
+    field_descr->set_history (2);
+
+    const int h21 = field_descr->history_id(i2,1);
+    const int h22 = field_descr->history_id(i2,2);
+
+    unit_func("reset_history");
+
+    unit_assert (field_descr->add_history_field("f1"));
+    field_descr->reset_history (2);
+
+    unit_assert (field_descr->num_temporary() == 4);
+    std::vector<int> ids = { field_descr->history_id(i1,1),
+                             field_descr->history_id(i1,2),
+                             field_descr->history_id(i2,1),
+                             field_descr->history_id(i2,2) };
+    unit_assert (std::find(ids.begin(),ids.end(),h21) != ids.end());
+    unit_assert (std::find(ids.begin(),ids.end(),h22) != ids.end());
+    std::sort(ids.begin(),ids.end());
+    unit_assert (std::unique(ids.begin(),ids.end()) == ids.end());
+
+    // rebuilding without changes inserts no temporaries
+    field_descr->reset_history (2);
+    unit_assert (field_descr->num_temporary() == 4);
+
+    delete field_descr;
+  }
+
   //----------------------------------------------------------------------
   // FieldDescr Tests from test_FieldDescr
   //----------------------------------------------------------------------
@@ -226,6 +226,81 @@ PARALLEL_MAIN_BEGIN
   unit_func ("num_delete()");
   unit_assert(memory->num_delete() == del_count);
 
+  // pool: alignment and reuse of freed blocks
+
+  unit_func ("pool");
+
+  memory->set_pool_limit_mb(1.0);
+
+  double * a1 = new double [1000];
+  unit_assert ((uintptr_t)(a1) % 64 == 0);
+  delete [] a1;
+  const int64_t hits = memory->num_pool_hits();
+  unit_assert (memory->bytes_pool() > 0);
+  double * a2 = new double [990];
+  unit_assert ((uintptr_t)(a2) % 64 == 0);
+  unit_assert (memory->num_pool_hits() == hits + 1);
+  delete [] a2;
+
+  // freed small blocks are held and counted in bytes_pool()
+  const int64_t bytes_pool_small = memory->bytes_pool();
+  char * s1 = new char [40];
+  unit_assert (memory->bytes_pool() <= bytes_pool_small);
+  const int64_t bytes_pool_used = memory->bytes_pool();
+  delete [] s1;
+  unit_assert (memory->bytes_pool() > bytes_pool_used);
+
+  // allocations larger than pool_limit_mb are not held for reuse
+  char * a3 = new char [2000000];
+  unit_assert ((uintptr_t)(a3) % 64 == 0);
+  const int64_t bytes_pool = memory->bytes_pool();
+  delete [] a3;
+  unit_assert (memory->bytes_pool() == bytes_pool);
+
+  memory->set_pool_limit_mb(0.0);
+
+  // buffer pool: released buffers are reused by size
+
+  unit_func ("acquire_buffer");
+
+  memory->set_buffer_pool(true);
+
+  const int64_t buffer_misses = memory->num_buffer_misses();
+  char * b1 = memory->acquire_buffer(4000);
+  char * b2 = memory->acquire_buffer(4000);
+  unit_assert (memory->num_buffer_misses() == buffer_misses + 2);
+  unit_assert (memory->num_buffers_active() >= 2);
+  memory->release_buffer(b1,4000);
+  unit_assert (memory->bytes_buffers() >= 4000);
+
+  const int64_t buffer_hits = memory->num_buffer_hits();
+  char * b3 = memory->acquire_buffer(4000);
+  unit_assert (memory->num_buffer_hits() == buffer_hits + 1);
+
+  // a buffer of a different size is not reused
+  char * b4 = memory->acquire_buffer(2000);
+  unit_assert (b4 != b1 && b4 != b2);
+
+  unit_func ("release_buffer");
+  const int64_t active = memory->num_buffers_active();
+  memory->release_buffer(b2,4000);
+  memory->release_buffer(b3,4000);
+  memory->release_buffer(b4,2000);
+  unit_assert (memory->num_buffers_active() == active - 3);
+  unit_assert (memory->num_buffers_active_high() >= 3);
+
+  // held buffers are bounded by buffer_limit_mb
+
+  unit_func ("set_buffer_limit_mb");
+  unit_assert (memory->bytes_buffers() >= 8000);
+  memory->set_buffer_limit_mb(0.005);
+  unit_assert (memory->bytes_buffers() <= 5000);
+  char * b5 = memory->acquire_buffer(8000);
+  const int64_t bytes_buffers = memory->bytes_buffers();
+  memory->release_buffer(b5,8000);
+  unit_assert (memory->bytes_buffers() == bytes_buffers);
+  memory->set_buffer_limit_mb(64.0);
+
   memory->print();
 #else /* CONFIG_USE_MEMORY */
   unit_func("CONFIG_USE_MEMORY");
@@ -138,6 +138,65 @@ PARALLEL_MAIN_BEGIN
   unit_assert(region_counters[index_counter_1] == 50);
   unit_assert(region_counters[index_counter_2] == 100);
 
+  unit_func("new_region(name)");
+
+  const int id_region_3 = performance->new_region("region_3");
+
+  unit_assert (id_region_3 == 2);
+  unit_assert (performance->region_index("region_3") == id_region_3);
+
+  unit_func("enter_region");
+
+  // nested enter_region() calls count once
+
+  performance->enter_region(id_region_3);
+  performance->increment_counter(id_counter_1,7);
+  performance->enter_region(id_region_3);
+  performance->increment_counter(id_counter_1,3);
+  performance->exit_region(id_region_3);
+
+  unit_assert (performance->is_region_active(id_region_3));
+
+  performance->increment_counter(id_counter_1,1);
+  performance->exit_region(id_region_3);
+
+  unit_assert (! performance->is_region_active(id_region_3));
+
+  performance->increment_counter(id_counter_1,100);
+
+  performance->region_counters(id_region_3,region_counters);
+
+  unit_assert(region_counters[index_counter_1] == 7 + 3 + 1);
+
+  unit_func("Tracer");
+
+  Tracer * tracer = Tracer::instance();
+
+  // inactive until given a buffer
+
+  tracer->set_active(true);
+  unit_assert (! tracer->is_active());
+
+  tracer->set_capacity(4);
+  tracer->set_active(true);
+  unit_assert (tracer->is_active());
+
+  const int id_name = tracer->name_id("event");
+  unit_assert (tracer->name_id("event") == id_name);
+  unit_assert (tracer->name_id("other") != id_name);
+
+  for (int i=0; i<6; i++) tracer->instant(id_name,i);
+
+  unit_assert (tracer->num_events() == 4);
+  unit_assert (tracer->num_dropped() == 2);
+
+  tracer->set_active(false);
+  tracer->instant(id_name,6);
+  unit_assert (tracer->num_events() == 4);
+
+  tracer->clear();
+  unit_assert (tracer->num_events() == 0);
+
   performance->end();
 
   int num_regions = performance->num_regions();
@@ -177,6 +177,8 @@ extern "C" {
 
 #include "enzo_EnzoFieldArrayFactory.hpp"
 #include "enzo_EnzoEFltArrayMap.hpp"
+#include "enzo_EnzoEFltArrayArena.hpp"
+#include "enzo_EnzoHydroWorkspace.hpp"
 #include "enzo_EnzoPermutedCoordinates.hpp"
 #include "enzo_EnzoCenteredFieldRegistry.hpp"
 
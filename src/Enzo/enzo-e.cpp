@@ -37,6 +37,10 @@
 
 #include "charm_enzo.hpp"
 
+#ifdef CONFIG_USE_CKLOOP
+#  include "CkLoopAPI.h"
+#endif
+
 // The following needs to be included once and only once
 // This may not be the perfect place for this, but it is when it is included in
 // multiple object files
@@ -117,6 +121,19 @@ PARALLEL_MAIN_BEGIN
   }
 #endif
 
+  // Initialize CkLoop for threaded PPM slice sweeps
+
+#ifdef CONFIG_USE_CKLOOP
+  CkLoop_Init();
+#else
+  if (g_enzo_config.ppm_threads > 1) {
+    WARNING1("Main::Main()",
+             "Method:ppm:threads = %d: slices swept serially "
+             "without use_ckloop",
+             g_enzo_config.ppm_threads);
+  }
+#endif
+
  //--------------------------------------------------
 
   proxy_main     = thishandle;
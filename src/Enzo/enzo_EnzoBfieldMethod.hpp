@@ -126,9 +126,12 @@ public: // interface
   /// @param[in]     stale_depth The current staling depth. This is the stale
   ///     depth from just before reconstruction plus the reconstructor's
   ///     immediate staling rate.
-  virtual void correct_reconstructed_bfield(EnzoEFltArrayMap &l_map,
-                                            EnzoEFltArrayMap &r_map, int dim,
-                                            int stale_depth) noexcept = 0;
+  /// @param[in]     offset The (z,y,x) indices within the block-sized arrays
+  ///     of the first element of the arrays in l_map and r_map. This is
+  ///     non-zero when the maps hold tiles of the block-sized arrays.
+  virtual void correct_reconstructed_bfield
+  (EnzoEFltArrayMap &l_map, EnzoEFltArrayMap &r_map, int dim, int stale_depth,
+   const std::array<int,3> &offset = {{0,0,0}}) noexcept = 0;
 
   /// In the case of Constrained Transport, identifies and stores the upwind
   /// direction.
@@ -7,6 +7,7 @@
 
 #include "cello.hpp"
 #include "enzo.hpp"
+#include <algorithm>    // std::min
 
 //----------------------------------------------------------------------
 
@@ -105,8 +106,8 @@ void EnzoBfieldMethodCT::check_required_fields() const noexcept
 //----------------------------------------------------------------------
 
 void EnzoBfieldMethodCT::correct_reconstructed_bfield
-(EnzoEFltArrayMap &l_map, EnzoEFltArrayMap &r_map, int dim,
- int stale_depth) noexcept
+(EnzoEFltArrayMap &l_map, EnzoEFltArrayMap &r_map, int dim, int stale_depth,
+ const std::array<int,3> &offset) noexcept
 {
   require_registered_block_(); // confirm that target_block_ is valid
 
@@ -130,13 +131,26 @@ void EnzoBfieldMethodCT::correct_reconstructed_bfield
     // interior faces.
     EnzoPermutedCoordinates coord(dim);
     CSlice full_ax(nullptr,nullptr);
-    EFlt3DArray bfield = coord.get_subarray((*cur_bfieldi_l)[dim],
-                                            full_ax, full_ax, CSlice(1,-1));
+    EFlt3DArray bfield_block = coord.get_subarray((*cur_bfieldi_l)[dim],
+                                                  full_ax, full_ax,
+                                                  CSlice(1,-1));
 
     const std::string names[3] = {"bfield_x", "bfield_y", "bfield_z"};
     EFlt3DArray l_bfield = l_map.at(names[dim]);
     EFlt3DArray r_bfield = r_map.at(names[dim]);
 
+    // select the portion of the interface values overlapping l_map and
+    // r_map (this is the whole block unless they hold tiles). Along dim, the
+    // reconstructed arrays have one more element than bfield_block
+    CSlice slices[3];
+    for (int i = 0; i < 3; i++){
+      int stop = std::min(offset[i] + (int)l_bfield.shape(i),
+                          (int)bfield_block.shape(i));
+      slices[i] = CSlice(offset[i], stop);
+    }
+    EFlt3DArray bfield = bfield_block.subarray(slices[0], slices[1],
+                                               slices[2]);
+
     // All 3 array objects are the same shape
     for (int iz = stale_depth; iz< bfield.shape(0) - stale_depth; iz++) {
       for (int iy = stale_depth; iy< bfield.shape(1) - stale_depth; iy++) {
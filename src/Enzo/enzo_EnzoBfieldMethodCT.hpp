@@ -54,9 +54,12 @@ public: // interface
   /// @param[in]     stale_depth The current staling depth. This is the stale
   ///     depth from just before reconstruction plus the reconstructor's
   ///     immediate staling rate.
-  void correct_reconstructed_bfield(EnzoEFltArrayMap &l_map,
-                                    EnzoEFltArrayMap &r_map, int dim,
-                                    int stale_depth) noexcept;
+  /// @param[in]     offset The (z,y,x) indices within the block-sized arrays
+  ///     of the first element of the arrays in l_map and r_map. This is
+  ///     non-zero when the maps hold tiles of the block-sized arrays.
+  void correct_reconstructed_bfield
+  (EnzoEFltArrayMap &l_map, EnzoEFltArrayMap &r_map, int dim, int stale_depth,
+   const std::array<int,3> &offset = {{0,0,0}}) noexcept;
 
   /// identifies and stores the upwind direction
   ///
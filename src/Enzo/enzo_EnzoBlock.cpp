@@ -36,6 +36,7 @@ int EnzoBlock::ProblemType[CONFIG_NODE_SIZE];
 int EnzoBlock::PPMFlatteningParameter[CONFIG_NODE_SIZE];
 int EnzoBlock::PPMDiffusionParameter[CONFIG_NODE_SIZE];
 int EnzoBlock::PPMSteepeningParameter[CONFIG_NODE_SIZE];
+int EnzoBlock::PPMThreads[CONFIG_NODE_SIZE];
 
 // Numerics
 
@@ -125,6 +126,7 @@ void EnzoBlock::initialize(const EnzoConfig * enzo_config)
     PPMFlatteningParameter[in]    = enzo_config->ppm_flattening;
     PPMDiffusionParameter[in]     = enzo_config->ppm_diffusion;
     PPMSteepeningParameter[in]    = enzo_config->ppm_steepening;
+    PPMThreads[in]                = enzo_config->ppm_threads;
     pressure_floor[in]            = enzo_config->ppm_pressure_floor;
     density_floor[in]             = enzo_config->ppm_density_floor;
     temperature_floor[in]         = enzo_config->ppm_temperature_floor;
@@ -294,6 +296,8 @@ void EnzoBlock::write(FILE * fp) throw ()
 	   PPMDiffusionParameter[in]);
   fprintf (fp,"EnzoBlock: PPMSteepeningParameter %d\n",
 	   PPMSteepeningParameter[in]);
+  fprintf (fp,"EnzoBlock: PPMThreads %d\n",
+	   PPMThreads[in]);
 
   // Numerics
 
@@ -63,6 +63,7 @@ public:
   static int PPMFlatteningParameter[CONFIG_NODE_SIZE];
   static int PPMDiffusionParameter[CONFIG_NODE_SIZE];
   static int PPMSteepeningParameter[CONFIG_NODE_SIZE];
+  static int PPMThreads[CONFIG_NODE_SIZE];
 
   // Parallel
 
@@ -29,6 +29,7 @@ EnzoConfig::EnzoConfig() throw ()
   ppm_pressure_free(false),
   ppm_temperature_floor(0.0),
   ppm_steepening(false),
+  ppm_threads(1),
   ppm_use_minimum_pressure_support(false),
   ppm_mol_weight(0.0),
   field_gamma(0.0),
@@ -110,6 +111,8 @@ EnzoConfig::EnzoConfig() throw ()
   initial_music_throttle_group_size(),
   initial_music_throttle_seconds_stagger(),
   initial_music_throttle_seconds_delay(),
+  initial_music_staged(),
+  initial_music_staged_slabs(),
   // EnzoInitialPm
   initial_pm_field(""),
   initial_pm_mpp(0.0),
@@ -260,6 +263,7 @@ EnzoConfig::EnzoConfig() throw ()
   method_vlct_mhd_choice(""),
   method_vlct_dual_energy(false),
   method_vlct_dual_energy_eta(0.0),
+  method_vlct_tile_depth(0),
   /// EnzoProlong
   prolong_enzo_type(),
   prolong_enzo_positive(true),
@@ -270,11 +274,13 @@ EnzoConfig::EnzoConfig() throw ()
   solver_coarse_solve(),
   solver_domain_solve(),
   solver_weight(),
+  solver_sweeps_per_refresh(),
   solver_restart_cycle(),
   /// EnzoSolver<Krylov>
   solver_precondition(),
   solver_coarse_level(),
   solver_is_unigrid(),
+  solver_merge_reductions(),
   stopping_redshift()
 
 {
@@ -336,6 +342,7 @@ void EnzoConfig::pup (PUP::er &p)
   p | ppm_pressure_free;
   p | ppm_temperature_floor;
   p | ppm_steepening;
+  p | ppm_threads;
   p | ppm_use_minimum_pressure_support;
   p | ppm_mol_weight;
 
@@ -439,6 +446,8 @@ void EnzoConfig::pup (PUP::er &p)
   p | initial_music_throttle_group_size;
   p | initial_music_throttle_seconds_stagger;
   p | initial_music_throttle_seconds_delay;
+  p | initial_music_staged;
+  p | initial_music_staged_slabs;
 
   p | initial_pm_field;
   p | initial_pm_mpp;
@@ -576,6 +585,7 @@ void EnzoConfig::pup (PUP::er &p)
   p | method_vlct_mhd_choice;
   p | method_vlct_dual_energy;
   p | method_vlct_dual_energy_eta;
+  p | method_vlct_tile_depth;
 
   p | prolong_enzo_type;
   p | prolong_enzo_positive;
@@ -586,10 +596,12 @@ void EnzoConfig::pup (PUP::er &p)
   p | solver_coarse_solve;
   p | solver_domain_solve;
   p | solver_weight;
+  p | solver_sweeps_per_refresh;
   p | solver_restart_cycle;
   p | solver_precondition;
   p | solver_coarse_level;
   p | solver_is_unigrid;
+  p | solver_merge_reductions;
 
   p | stopping_redshift;
 
@@ -666,6 +678,8 @@ void EnzoConfig::read(Parameters * p) throw()
     ("Method:ppm:temperature_floor", floor_default);
   ppm_steepening = p->value_logical
     ("Method:ppm:steepening", false);
+  ppm_threads = p->value_integer
+    ("Method:ppm:threads", 1);
   ppm_use_minimum_pressure_support = p->value_logical
     ("Method:ppm:use_minimum_pressure_support",false);
   ppm_mol_weight = p->value_float
@@ -721,6 +735,10 @@ void EnzoConfig::read(Parameters * p) throw()
     ("Initial:music:throttle_seconds_stagger",0.0);
   initial_music_throttle_seconds_delay = p->value_float
     ("Initial:music:throttle_seconds_delay",0.0);
+  initial_music_staged = p->value_logical
+    ("Initial:music:staged",false);
+  initial_music_staged_slabs = p->value_integer
+    ("Initial:music:staged_slabs",8);
 
   // PM method and initialization
 
@@ -1235,6 +1253,8 @@ void EnzoConfig::read(Parameters * p) throw()
     ("Method:mhd_vlct:dual_energy", false);
   method_vlct_dual_energy_eta = p->value_float
     ("Method:mhd_vlct:dual_energy_eta", 0.001);
+  method_vlct_tile_depth = p->value_integer
+    ("Method:mhd_vlct:tile_depth", 0);
 
   // we should raise an error if mhd_choice is not specified
   bool uses_vlct = false;
@@ -1313,10 +1333,12 @@ void EnzoConfig::read(Parameters * p) throw()
   solver_post_smooth. resize(num_solvers);
   solver_last_smooth. resize(num_solvers);
   solver_weight.      resize(num_solvers);
+  solver_sweeps_per_refresh.resize(num_solvers);
   solver_restart_cycle.resize(num_solvers);
   solver_precondition.resize(num_solvers);
   solver_coarse_level.resize(num_solvers);
   solver_is_unigrid.resize(num_solvers);
+  solver_merge_reductions.resize(num_solvers);
 
   for (int index_solver=0; index_solver<num_solvers; index_solver++) {
 
@@ -1370,6 +1392,14 @@ void EnzoConfig::read(Parameters * p) throw()
     solver_weight[index_solver] =
       p->value_float(solver_name + ":weight",1.0);
 
+    solver_sweeps_per_refresh[index_solver] =
+      p->value_integer(solver_name + ":sweeps_per_refresh",1);
+
+    ASSERT2 ("EnzoConfig::read()",
+             "%s:sweeps_per_refresh = %d must be at least 1",
+             solver_name.c_str(),solver_sweeps_per_refresh[index_solver],
+             solver_sweeps_per_refresh[index_solver] >= 1);
+
     solver_restart_cycle[index_solver] =
       p->value_integer(solver_name + ":restart_cycle",1);
 
@@ -1380,6 +1410,9 @@ void EnzoConfig::read(Parameters * p) throw()
     solver_is_unigrid[index_solver] =
       p->value_logical (solver_name + ":is_unigrid",false);
 
+    solver_merge_reductions[index_solver] =
+      p->value_logical (solver_name + ":merge_reductions",false);
+
   }
 
   //======================================================================
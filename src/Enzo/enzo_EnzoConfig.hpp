@@ -120,6 +120,7 @@ public: // interface
       ppm_pressure_free(false),
       ppm_temperature_floor(0.0),
       ppm_steepening(false),
+      ppm_threads(1),
       ppm_use_minimum_pressure_support(false),
       ppm_mol_weight(0.0),
       field_gamma(0.0),
@@ -204,6 +205,8 @@ public: // interface
       initial_music_throttle_group_size(),
       initial_music_throttle_seconds_stagger(),
       initial_music_throttle_seconds_delay(),
+      initial_music_staged(),
+      initial_music_staged_slabs(),
       // EnzoInitialPm
       initial_pm_field(""),
       initial_pm_mpp(0.0),
@@ -355,6 +358,7 @@ public: // interface
       method_vlct_mhd_choice(""),
       method_vlct_dual_energy(false),
       method_vlct_dual_energy_eta(0.0),
+      method_vlct_tile_depth(0),
       // EnzoProlong
       prolong_enzo_type(),
       prolong_enzo_positive(true),
@@ -365,11 +369,13 @@ public: // interface
       solver_coarse_solve(),
       solver_domain_solve(),
       solver_weight(),
+      solver_sweeps_per_refresh(),
       solver_restart_cycle(),
       // EnzoSolver<Krylov>
       solver_precondition(),
       solver_coarse_level(),
       solver_is_unigrid(),
+      solver_merge_reductions(),
       // EnzoStopping
       stopping_redshift()
 
@@ -420,6 +426,7 @@ public: // attributes
   bool                       ppm_pressure_free;
   double                     ppm_temperature_floor;
   bool                       ppm_steepening;
+  int                        ppm_threads;
   bool                       ppm_use_minimum_pressure_support;
   double                     ppm_mol_weight;
 
@@ -512,6 +519,8 @@ public: // attributes
   int                         initial_music_throttle_group_size;
   double                      initial_music_throttle_seconds_stagger;
   double                      initial_music_throttle_seconds_delay;
+  bool                        initial_music_staged;
+  int                         initial_music_staged_slabs;
 
   /// EnzoInitialPm
   std::string                initial_pm_field;
@@ -713,6 +722,7 @@ public: // attributes
   // unlike ppm, only use a single eta value. It should have a default value
   // closer to method_ppm_dual_energy_eta1
   double                     method_vlct_dual_energy_eta;
+  int                        method_vlct_tile_depth;
 
 
   std::string                prolong_enzo_type;
@@ -746,6 +756,10 @@ public: // attributes
 
   std::vector<double>        solver_weight;
 
+  /// Maximum number of EnzoSolverJacobi sweeps between ghost refreshes
+
+  std::vector<int>           solver_sweeps_per_refresh;
+
   /// Whether to start the iterative solver using the previous solution
 
   std::vector<int>           solver_restart_cycle;
@@ -760,6 +774,10 @@ public: // attributes
   std::vector<int>           solver_coarse_level;
   std::vector<int>           solver_is_unigrid;
 
+  /// Whether EnzoSolverBiCgStab merges the DOT(R,R) and DOT(R,R0)
+  /// reduction into the preceding reduction
+  std::vector<int>           solver_merge_reductions;
+
   /// Stop at specified redshift for cosmology
   double                     stopping_redshift;
 
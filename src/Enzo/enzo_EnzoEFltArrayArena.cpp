@@ -0,0 +1,84 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoEFltArrayArena.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Enzo] Implementation of the EnzoEFltArrayArena class
+
+#include "cello.hpp"
+#include "enzo.hpp"
+
+EnzoEFltArrayArena EnzoEFltArrayArena::instance_[CONFIG_NODE_SIZE];
+
+//----------------------------------------------------------------------
+
+CelloArray<enzo_float,4> EnzoEFltArrayArena::get(int n, int mz, int my,
+                                                 int mx) noexcept
+{
+  ASSERT4("EnzoEFltArrayArena::get",
+          "invalid array shape (%d, %d, %d, %d)", n, mz, my, mx,
+          (n > 0) && (mz > 0) && (my > 0) && (mx > 0));
+
+  const std::size_t size = std::size_t(n)*mz*my*mx;
+  const long long bytes = size*sizeof(enzo_float);
+
+  if (next_ == storage_.size()) {
+    storage_.emplace_back();
+  }
+  std::vector<enzo_float> & buffer = storage_[next_++];
+
+  // reused storage keeps the values from its previous use: callers
+  // overwrite scratch arrays, and clear accumulators (e.g. dUcons)
+  // themselves
+  if (buffer.size() >= size) {
+    bytes_reused_ += bytes;
+  } else {
+    buffer.resize(size);
+    bytes_allocated_ += bytes;
+  }
+
+  return CelloArray<enzo_float,4>(buffer.data(), n, mz, my, mx);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoEFltArrayArena::add_to_map
+(EnzoEFltArrayMap &map, const std::array<int,3> &shape,
+ const std::vector<std::string> &keys) noexcept
+{
+  if (keys.size() == 0) { return; }
+
+  CelloArray<enzo_float,4> data = get((int)keys.size(), shape[0], shape[1],
+                                      shape[2]);
+  for (std::size_t i = 0; i < keys.size(); i++){
+    map[keys[i]] = data.leading_subarray(i);
+  }
+}
+
+//----------------------------------------------------------------------
+
+long long EnzoEFltArrayArena::bytes() const noexcept
+{
+  long long bytes = 0;
+  for (const std::vector<enzo_float>& buffer : storage_){
+    bytes += buffer.capacity()*sizeof(enzo_float);
+  }
+  return bytes;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoEFltArrayArena::new_counters() noexcept
+{
+  index_counter_ = cello::simulation()->performance()->user_counters
+    ({"arena-bytes-reused", "arena-bytes-allocated", "arena-bytes"});
+}
+
+//----------------------------------------------------------------------
+
+void EnzoEFltArrayArena::update_counters() const noexcept
+{
+  if (index_counter_.empty()) { return; }
+  cello::simulation()->performance()->assign_counters
+    (index_counter_, {bytes_reused_, bytes_allocated_, bytes()});
+}
@@ -0,0 +1,101 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoEFltArrayArena.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Enzo] Declaration of EnzoEFltArrayArena, a per-process
+///           pool of scratch space for temporary EFlt3DArrays
+///
+/// Methods like EnzoMethodMHDVlct construct dozens of temporary arrays (with
+/// the shape of a cell-centered field) every time they are applied to a
+/// Block. Rather than allocating (and page-faulting) fresh memory for each
+/// array, arrays can be drawn from this arena. Storage is handed out in the
+/// order it is requested, so as long as each Block requests the same
+/// sequence of shapes (i.e. the same block shape and list of quantities),
+/// the i-th request always reuses the storage from the i-th request for the
+/// previous Block. Storage only grows, so it is effectively sized once per
+/// run.
+
+#ifndef ENZO_ENZO_EFLT_ARRAY_ARENA_HPP
+#define ENZO_ENZO_EFLT_ARRAY_ARENA_HPP
+
+class EnzoEFltArrayArena {
+
+  /// @class    EnzoEFltArrayArena
+  /// @ingroup  Enzo
+  /// @brief    [\ref Enzo] Per-process scratch space for EFlt3DArrays
+
+public: // interface
+
+  /// Create an empty arena
+  EnzoEFltArrayArena()
+    : storage_(),
+      next_(0),
+      bytes_reused_(0),
+      bytes_allocated_(0),
+      index_counter_()
+  { }
+
+  /// Return the arena for the current process
+  static EnzoEFltArrayArena * instance() throw()
+  { return & instance_[cello::index_static()]; }
+
+  /// Make all scratch space available for reuse. This must be called before
+  /// processing each Block, and invalidates all arrays previously returned.
+  void reset() noexcept { next_ = 0; }
+
+  /// Return an array with the given shape. Its values are left over from
+  /// earlier use of the storage, so callers must not rely on them
+  EFlt3DArray get(int mz, int my, int mx) noexcept
+  { return get(1, mz, my, mx).leading_subarray(0); }
+
+  /// Return a contiguous stack of n arrays with the given shape, with
+  /// unspecified values
+  CelloArray<enzo_float,4> get(int n, int mz, int my, int mx) noexcept;
+
+  /// Insert a scratch array with the given shape into map for each key in
+  /// keys. The inserted arrays are slices of a single contiguous
+  /// CelloArray<enzo_float,4>
+  void add_to_map(EnzoEFltArrayMap &map, const std::array<int,3> &shape,
+                  const std::vector<std::string> &keys) noexcept;
+
+  /// Number of bytes handed out that reused existing storage
+  long long bytes_reused() const noexcept { return bytes_reused_; }
+
+  /// Number of bytes handed out that required new storage
+  long long bytes_allocated() const noexcept { return bytes_allocated_; }
+
+  /// Current size of the arena in bytes
+  long long bytes() const noexcept;
+
+  /// Create the "arena-bytes-reused", "arena-bytes-allocated" and
+  /// "arena-bytes" Performance counters if they don't exist. Must be
+  /// called on all processes, e.g. from a Method constructor
+  void new_counters() noexcept;
+
+  /// Assign the arena statistics to its Performance counters
+  void update_counters() const noexcept;
+
+private: // attributes
+
+  /// Per-process instances
+  static EnzoEFltArrayArena instance_[CONFIG_NODE_SIZE];
+
+  /// Scratch storage, in the order it was requested
+  std::vector< std::vector<enzo_float> > storage_;
+
+  /// Index of the next entry in storage_ to hand out
+  std::size_t next_;
+
+  /// Cumulative number of bytes handed out from existing storage
+  long long bytes_reused_;
+
+  /// Cumulative number of bytes handed out requiring new storage
+  long long bytes_allocated_;
+
+  /// Performance counter indices for bytes reused, bytes allocated, and
+  /// arena size, or empty if not created
+  std::vector<int> index_counter_;
+};
+
+#endif /* ENZO_ENZO_EFLT_ARRAY_ARENA_HPP */
@@ -10,14 +10,88 @@
 
 //----------------------------------------------------------------------
 
+EnzoEFltArrayMap::EnzoEFltArrayMap(std::string name,
+                                   const std::vector<std::string> &keys,
+                                   const CelloArray<enzo_float,4> &data)
+  : EnzoEFltArrayMap(name)
+{
+  ASSERT2("EnzoEFltArrayMap::EnzoEFltArrayMap",
+          "the first axis of data has length %d, but there are %d keys",
+          data.shape(0), (int)keys.size(),
+          (std::size_t)data.shape(0) == keys.size());
+  init_keys_(keys);
+  for (std::size_t i = 0; i < keys.size(); i++){
+    arrays_.push_back(data.leading_subarray(i));
+  }
+}
+
+//----------------------------------------------------------------------
+
+EnzoEFltArrayMap::EnzoEFltArrayMap(std::string name,
+                                   const std::vector<std::string> &keys,
+                                   const std::array<int,3> &shape)
+  : EnzoEFltArrayMap(name, keys,
+                     CelloArray<enzo_float,4>((int)keys.size(), shape[0],
+                                              shape[1], shape[2]))
+{ }
+
+//----------------------------------------------------------------------
+
+void EnzoEFltArrayMap::init_keys_(const std::vector<std::string> &keys)
+  noexcept
+{
+  ASSERT("EnzoEFltArrayMap::init_keys_", "the map must be empty",
+         size() == 0);
+  for (std::size_t i = 0; i < keys.size(); i++){
+    ASSERT1("EnzoEFltArrayMap::init_keys_",
+            "EnzoEFltArrayMap can't hold more than one key called \"%s\"",
+            keys[i].c_str(), !contains(keys[i]));
+    key_table_->indices[keys[i]] = i;
+  }
+  key_table_->keys = keys;
+}
+
+//----------------------------------------------------------------------
+
+EFlt3DArray& EnzoEFltArrayMap::operator[] (const std::string& key)
+{
+  auto result = key_table_->indices.find(key);
+  if (result != key_table_->indices.cend()){
+    return arrays_[result->second];
+  }
+
+  // insert the key (copying the key table if it's shared with another map)
+  if (key_table_.use_count() > 1){
+    key_table_ = std::make_shared<KeyTable_>(*key_table_);
+  }
+  key_table_->indices[key] = arrays_.size();
+  key_table_->keys.push_back(key);
+  arrays_.emplace_back();
+  return arrays_.back();
+}
+
+//----------------------------------------------------------------------
+
+std::size_t EnzoEFltArrayMap::index(const std::string& key) const noexcept
+{
+  auto result = key_table_->indices.find(key);
+  if (result == key_table_->indices.cend()){
+    ERROR1("EnzoEFltArrayMap::index", "map doesn't contain the key: \"%s\"",
+           key.c_str());
+  }
+  return result->second;
+}
+
+//----------------------------------------------------------------------
+
 const EFlt3DArray& EnzoEFltArrayMap::at(const std::string& key) const noexcept
 {
-  auto result = map_.find(key);
-  if (result == map_.cend()){
+  auto result = key_table_->indices.find(key);
+  if (result == key_table_->indices.cend()){
     ERROR1("EnzoEFltArrayMap::at", "map doesn't contain the key: \"%s\"",
            key.c_str());
   }
-  return result->second;
+  return arrays_[result->second];
 }
 
 //----------------------------------------------------------------------
@@ -36,10 +110,18 @@ EFlt3DArray exclude_stale_cells_(const EFlt3DArray &arr, int stale_depth)
 
 EFlt3DArray EnzoEFltArrayMap::get(const std::string& key,
                                   int stale_depth) const noexcept
+{
+  return get(index(key), stale_depth);
+}
+
+//----------------------------------------------------------------------
+
+EFlt3DArray EnzoEFltArrayMap::get(std::size_t index,
+                                  int stale_depth) const noexcept
 {
   ASSERT("EnzoEFltArrayMap::get", "stale_depth must be >= 0",
          stale_depth >= 0);
-  const EFlt3DArray& arr = this->at(key);
+  const EFlt3DArray& arr = arrays_[index];
   if (stale_depth > 0){
     return exclude_stale_cells_(arr,stale_depth);
   } else {
@@ -49,6 +131,22 @@ EFlt3DArray EnzoEFltArrayMap::get(const std::string& key,
 
 //----------------------------------------------------------------------
 
+EnzoEFltArrayMap EnzoEFltArrayMap::subarray_map
+(const CSlice &slc_z, const CSlice &slc_y, const CSlice &slc_x,
+ const std::string& name) const noexcept
+{
+  EnzoEFltArrayMap out(name);
+  // the key table is shared, rather than copied
+  out.key_table_ = key_table_;
+  out.arrays_.reserve(arrays_.size());
+  for (const EFlt3DArray &arr : arrays_){
+    out.arrays_.push_back(arr.subarray(slc_z, slc_y, slc_x));
+  }
+  return out;
+}
+
+//----------------------------------------------------------------------
+
 void EnzoEFltArrayMap::print_summary() const noexcept
 {
   std::size_t my_size = size();
@@ -71,17 +169,18 @@ void EnzoEFltArrayMap::print_summary() const noexcept
   int i = 0;
   CkPrintf("{");
 
-  for ( const auto &pair : map_ ) {
+  for (std::size_t index = 0; index < my_size; index++) {
+    const EFlt3DArray &arr = arrays_[index];
     if (i != 0){
       CkPrintf(",\n ");
     }
     CkPrintf("\"%s\" : EFlt3DArray(%p, %d, %d, %d), owners: %ld",
-             pair.first.c_str(),
-             (void*)pair.second.shared_data_.get(),
-             (int)pair.second.shape(0),
-             (int)pair.second.shape(1),
-             (int)pair.second.shape(2),
-             pair.second.shared_data_.use_count());
+             key(index).c_str(),
+             (void*)arr.shared_data_.get(),
+             (int)arr.shape(0),
+             (int)arr.shape(1),
+             (int)arr.shape(2),
+             arr.shared_data_.use_count());
     i++;
   }
   CkPrintf("}\n");
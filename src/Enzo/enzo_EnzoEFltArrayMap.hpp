@@ -7,30 +7,20 @@
 ///           used to hold collections of EFlt3DArrays
 ///
 /// This largely exists to help simplify the transition of EnzoMethodMHDVlct's
-/// implementation from using Groupings to using Maps. It may not be optimal to
-/// define this as it's own class
+/// implementation from using Groupings to using Maps.
 ///
-/// I'm starting to think that a more optimal approach may be to perform all
-/// insertions in the constructor and to thereafter freeze the contained
-/// arrays (the entries of the arrays could still be modified).
-///   - The class could then provide the interface of a const std::map.
-///   - It could also potentially enforce that all contained arrays have a
-///     fixed shape
+/// The arrays are stored in a vector, in the order that their keys were
+/// inserted, alongside a table relating each key to its index. The string
+/// keys are intended for setup: routines that repeatedly access the same
+/// arrays (e.g. the Riemann Solvers) can resolve the index of each key once
+/// and thereafter access arrays with `operator[](std::size_t)`, or iterate
+/// over all arrays by index. The key table is shared between copies of a
+/// map (and maps returned by `subarray_map`), so that copying a map only
+/// copies the array views.
 ///
-/// This choice, also facillitates further optimizations based on the capacity
-/// to guarantee the ordering of arrays held within an instance. If the
-/// ordering is based off the requirements of the Riemann Solver and the class
-/// offers a method to return a (const?) vector of arrays with that ordering,
-/// optimizations could be made to the Riemann Solver (as well as
-/// EnzoReconstructor and EnzoIntegrableUpdater). This could be most
-/// efficiently achieved by internally storing the contained array within a
-/// vector and also storing some kind of mapping relating the keys to indices
-/// the vector.
-///
-/// To achieve similar results, instead of storing individual EFlt3DArrays
-/// within vectors, one large instance of CelloArray<enzo_float,4> could be
-/// stored. While that may help compiler optimizations, it may be too
-/// restrictive.
+/// A map can also be constructed from a list of keys and a shape, in which
+/// case the arrays are views of a single contiguous CelloArray<enzo_float,4>
+/// (the i-th array is the i-th slice along the first axis).
 
 #ifndef ENZO_ENZO_EFLT_ARRAY_MAP_HPP
 #define ENZO_ENZO_EFLT_ARRAY_MAP_HPP
@@ -42,33 +32,96 @@ class EnzoEFltArrayMap {
 
 public: // interface
 
+  /// Construct an empty map. Arrays are inserted with `operator[]`
   EnzoEFltArrayMap(std::string name = "")
-    : name_(name)
+    : name_(name),
+      key_table_(std::make_shared<KeyTable_>()),
+      arrays_()
   { }
 
-  EFlt3DArray& operator[] (const std::string& key){ return map_[key]; }
-  EFlt3DArray& operator[] (std::string&& key){ return map_[key]; }
+  /// Construct a map holding an array for each key in keys. The arrays are
+  /// views of the slices along the first axis of data, which must have
+  /// `keys.size()` entries along that axis
+  EnzoEFltArrayMap(std::string name, const std::vector<std::string> &keys,
+                   const CelloArray<enzo_float,4> &data);
+
+  /// Construct a map holding a zero-initialized array of the specified shape
+  /// for each key in keys. The arrays are views of a single, newly allocated,
+  /// contiguous CelloArray<enzo_float,4>
+  EnzoEFltArrayMap(std::string name, const std::vector<std::string> &keys,
+                   const std::array<int,3> &shape);
+
+  /// Access the array associated with key. If the map doesn't contain key, it
+  /// is inserted (holding an uninitialized array)
+  EFlt3DArray& operator[] (const std::string& key);
+
+  /// Access the array at the specified index
+  EFlt3DArray& operator[] (std::size_t index) noexcept
+  { return arrays_[index]; }
+  const EFlt3DArray& operator[] (std::size_t index) const noexcept
+  { return arrays_[index]; }
 
   const EFlt3DArray& at(const std::string& key) const noexcept;
 
   bool contains(const std::string& key) const noexcept{
-    return (map_.find(key) != map_.cend());
+    return (key_table_->indices.find(key) != key_table_->indices.cend());
   }
 
+  /// Returns the index of the array associated with key (it's an error if
+  /// the map doesn't contain key)
+  std::size_t index(const std::string& key) const noexcept;
+
+  /// Returns the key associated with the array at the specified index
+  const std::string& key(std::size_t index) const noexcept
+  { return key_table_->keys[index]; }
+
+  /// Returns the keys of the map, ordered by index
+  const std::vector<std::string>& keys() const noexcept
+  { return key_table_->keys; }
+
   /// Similar to at, but a slice of the array ommitting staled values is
   /// returned by value
   EFlt3DArray get(const std::string& key,
                   int stale_depth = 0) const noexcept;
 
+  /// Similar to get, but the array is specified by its index
+  EFlt3DArray get(std::size_t index, int stale_depth = 0) const noexcept;
+
+  /// Returns a new map holding the same keys, where each array is the
+  /// subarray of the corresponding array in this map specified by the slices
+  /// (the subarrays share data with this map)
+  EnzoEFltArrayMap subarray_map(const CSlice &slc_z, const CSlice &slc_y,
+                                const CSlice &slc_x,
+                                const std::string& name = "") const noexcept;
+
   /// Provided to help debug
   void print_summary() const noexcept;
 
-  std::size_t size() const noexcept { return map_.size(); }
+  std::size_t size() const noexcept { return arrays_.size(); }
+
+private: // helper types
+
+  struct KeyTable_ {
+    /// keys ordered by index
+    std::vector<std::string> keys;
+    /// relates each key to its index
+    std::map<std::string, std::size_t> indices;
+  };
+
+private: // methods
+
+  /// Set the keys of the map (the map must be empty)
+  void init_keys_(const std::vector<std::string> &keys) noexcept;
 
 private: // attributes
   // name_ is to help with debugging!
   std::string name_;
-  std::map<std::string, EFlt3DArray> map_;
+
+  /// table relating keys and indices (shared with copies of this map)
+  std::shared_ptr<KeyTable_> key_table_;
+
+  /// arrays ordered by index
+  std::vector<EFlt3DArray> arrays_;
 };
 
 #endif /* ENZO_ENZO_EFLT_ARRAY_MAP_HPP */
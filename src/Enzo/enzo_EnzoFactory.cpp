@@ -213,6 +213,11 @@ void EnzoFactory::create_block
 
   enzo::simulation()->set_msg_refine (index,msg);
 
-  enzo_block_array[index].insert ( process_type(CkMyPe()) );
+  // insert on this (the parent Block's) process if requested,
+  // otherwise on the process given by MappingArray
+
+  const int ip = cello::config()->mesh_mapping_parent ? CkMyPe() : -1;
+
+  enzo_block_array[index].insert (process_type(CkMyPe()), ip);
 }
 
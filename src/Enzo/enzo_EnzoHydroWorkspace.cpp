@@ -0,0 +1,46 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoHydroWorkspace.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     Sat Oct 17 17:41:05 PDT 2026
+/// @brief    [\ref Enzo] Implementation of the EnzoHydroWorkspace class
+
+#include "cello.hpp"
+#include "enzo.hpp"
+
+EnzoHydroWorkspace EnzoHydroWorkspace::instance_[CONFIG_NODE_SIZE];
+
+//----------------------------------------------------------------------
+
+long long EnzoHydroWorkspace::bytes() const noexcept
+{
+  long long bytes = 0;
+  bytes += temp_.capacity()*sizeof(enzo_float);
+  bytes += range_temp_.capacity()*sizeof(enzo_float);
+  bytes += array_.capacity()*sizeof(int);
+  bytes += coloff_.capacity()*sizeof(int);
+  for (int axis=0; axis<3; axis++) {
+    bytes += cell_width_[axis].capacity()*sizeof(enzo_float);
+    bytes += velocity_[axis].capacity()*sizeof(enzo_float);
+    bytes += ie_error_[axis].capacity()*sizeof(int);
+  }
+  return bytes;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoHydroWorkspace::new_counters() noexcept
+{
+  index_counter_ = cello::simulation()->performance()->user_counters
+    ({"hydro-workspace-num-reused", "hydro-workspace-num-allocated",
+     "hydro-workspace-bytes"});
+}
+
+//----------------------------------------------------------------------
+
+void EnzoHydroWorkspace::update_counters() const noexcept
+{
+  if (index_counter_.empty()) { return; }
+  cello::simulation()->performance()->assign_counters
+    (index_counter_, {num_reused_, num_allocated_, bytes()});
+}
@@ -0,0 +1,133 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoHydroWorkspace.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     Sat Oct 17 17:41:05 PDT 2026
+/// @brief    [\ref Enzo] Declaration of EnzoHydroWorkspace, per-process
+///           scratch space for EnzoBlock::SolveHydroEquations()
+///
+/// SolveHydroEquations() needs several temporary arrays for each Block:
+/// the ppm_de work space, flux index arrays, color offsets, cell widths,
+/// and zero velocity arrays for collapsed dimensions. Rather than
+/// allocating and freeing them on every call, they are kept here and
+/// reused by the next Block on the same process. Arrays only grow, so
+/// they are sized by the first Block and reallocated only if a later
+/// Block is larger (e.g. more color fields). Contents are not
+/// initialized.
+
+#ifndef ENZO_ENZO_HYDRO_WORKSPACE_HPP
+#define ENZO_ENZO_HYDRO_WORKSPACE_HPP
+
+class EnzoHydroWorkspace {
+
+  /// @class    EnzoHydroWorkspace
+  /// @ingroup  Enzo
+  /// @brief    [\ref Enzo] Per-process scratch space for the PPM solver
+
+public: // interface
+
+  /// Create an empty workspace
+  EnzoHydroWorkspace()
+    : temp_(),
+      range_temp_(),
+      array_(),
+      coloff_(),
+      cell_width_(),
+      velocity_(),
+      ie_error_(),
+      num_reused_(0),
+      num_allocated_(0),
+      index_counter_()
+  { }
+
+  /// Return the workspace for the current process
+  static EnzoHydroWorkspace * instance() throw()
+  { return & instance_[cello::index_static()]; }
+
+  /// Work space for ppm_de
+  enzo_float * temp (std::size_t n) noexcept
+  { return get_(temp_,n); }
+
+  /// Work space for a range of slices swept by ppm_de_sweep on this
+  /// process on behalf of a (possibly different) process's Block
+  enzo_float * range_temp (std::size_t n) noexcept
+  { return get_(range_temp_,n); }
+
+  /// Flux index arrays
+  int * array (std::size_t n) noexcept
+  { return get_(array_,n); }
+
+  /// Offsets of color fields
+  int * coloff (std::size_t n) noexcept
+  { return get_(coloff_,n); }
+
+  /// Cell widths along the given axis
+  enzo_float * cell_width (int axis, std::size_t n) noexcept
+  { return get_(cell_width_[axis],n); }
+
+  /// Velocity array for an axis that is not a Block dimension
+  enzo_float * velocity (int axis, std::size_t n) noexcept
+  { return get_(velocity_[axis],n); }
+
+  /// Cell indices of internal energy errors along the given axis
+  int * ie_error (int axis, std::size_t n) noexcept
+  { return get_(ie_error_[axis],n); }
+
+  /// Number of requests satisfied by existing storage
+  long long num_reused() const noexcept { return num_reused_; }
+
+  /// Number of requests that required new storage
+  long long num_allocated() const noexcept { return num_allocated_; }
+
+  /// Current size of the workspace in bytes
+  long long bytes() const noexcept;
+
+  /// Create the "hydro-workspace-num-reused",
+  /// "hydro-workspace-num-allocated" and "hydro-workspace-bytes"
+  /// Performance counters if they don't exist. Must be called on all
+  /// processes, e.g. from a Method constructor
+  void new_counters() noexcept;
+
+  /// Assign the workspace statistics to its Performance counters
+  void update_counters() const noexcept;
+
+private: // functions
+
+  /// Return storage for at least n elements, growing it if needed
+  template <class T>
+  T * get_ (std::vector<T> & v, std::size_t n) noexcept
+  {
+    if (v.size() >= n) {
+      ++num_reused_;
+    } else {
+      v.resize(n);
+      ++num_allocated_;
+    }
+    return v.data();
+  }
+
+private: // attributes
+
+  /// Per-process instances
+  static EnzoHydroWorkspace instance_[CONFIG_NODE_SIZE];
+
+  std::vector<enzo_float> temp_;
+  std::vector<enzo_float> range_temp_;
+  std::vector<int>        array_;
+  std::vector<int>        coloff_;
+  std::vector<enzo_float> cell_width_[3];
+  std::vector<enzo_float> velocity_[3];
+  std::vector<int>        ie_error_[3];
+
+  /// Cumulative number of requests satisfied by existing storage
+  long long num_reused_;
+
+  /// Cumulative number of requests requiring new storage
+  long long num_allocated_;
+
+  /// Performance counter indices for requests reused, requests
+  /// allocated, and workspace size, or empty if not created
+  std::vector<int> index_counter_;
+};
+
+#endif /* ENZO_ENZO_HYDRO_WORKSPACE_HPP */
@@ -6,6 +6,7 @@
 /// @brief    Read initial conditions from HDF5
 ///           (multi-scale cosmological initial conditions)
 #include "enzo.hpp"
+#include <array>
 #include <chrono>
 #include <thread>
 
@@ -23,6 +24,33 @@ void mutex_init()
 
 //----------------------------------------------------------------------
 
+/// Number of Blocks that have read from each file, for closing files
+/// opened with throttle_node_files
+static std::map<std::string,int> close_count;
+
+/// Slab of a MUSIC dataset held for reuse by Blocks on this process
+struct MusicSlab {
+  std::vector<char> data;
+  int o4[4];
+  int n4[4];
+  long long last_use;
+};
+
+/// Dimensions, type, and cached slabs of a MUSIC dataset.  The cache
+/// is per process, so it is only shared by the PEs of a node in SMP
+/// builds; access is guarded by throttle_node_lock
+struct MusicDataset {
+  int type;
+  int m4[4];
+  /// Slabs by offset and extent along the fastest-varying axis
+  std::map< std::array<int,5>, MusicSlab > slabs;
+};
+
+static std::map<std::string, MusicDataset> music_datasets;
+static long long music_slab_counter = 0;
+
+//----------------------------------------------------------------------
+
 EnzoInitialMusic::EnzoInitialMusic
 (int cycle,
  double time,
@@ -45,7 +73,9 @@ EnzoInitialMusic::EnzoInitialMusic
     throttle_close_count_(enzo_config->initial_music_throttle_close_count),
     throttle_group_size_    (enzo_config->initial_music_throttle_group_size),
     throttle_seconds_stagger_ (enzo_config->initial_music_throttle_seconds_stagger),
-    throttle_seconds_delay_ (enzo_config->initial_music_throttle_seconds_delay)
+    throttle_seconds_delay_ (enzo_config->initial_music_throttle_seconds_delay),
+    staged_ (enzo_config->initial_music_staged),
+    staged_slabs_ (enzo_config->initial_music_staged_slabs)
 {
 }
 
@@ -76,6 +106,8 @@ void EnzoInitialMusic::pup (PUP::er &p)
   p | throttle_group_size_;
   p | throttle_seconds_stagger_;
   p | throttle_seconds_delay_;
+  p | staged_;
+  p | staged_slabs_;
 }
 
 //----------------------------------------------------------------------
@@ -90,25 +122,13 @@ void EnzoInitialMusic::enforce_block
   // reducing filesystem contention on large runs
   throttle_stagger_();
  
-  // Get the grid size at level_
-  double lower_domain[3];
-  double upper_domain[3];
-  hierarchy->lower(lower_domain, lower_domain+1, lower_domain+2);
-  hierarchy->upper(upper_domain, upper_domain+1, upper_domain+2);
-
   double lower_block[3];
-  double upper_block[3];
   block->lower(lower_block, lower_block+1, lower_block+2);
-  block->upper(upper_block, upper_block+1, upper_block+2);
 
   Field field = block->data()->field();
 
-  static std::map<std::string,int> close_count;
-  
   for (size_t index=0; index<field_files_.size(); index++) {
 
-    const std::string file_name = field_files_[index];
-
     // Block size
 
     int mx,my,mz;
@@ -119,108 +139,23 @@ void EnzoInitialMusic::enforce_block
     field.size         (&nx,&ny,&nz);
     field.ghost_depth(0,&gx,&gy,&gz);
 
-    // Open the field file
-
-    if (throttle_intranode_) {
-      CmiLock(throttle_node_lock);
-    }
-
-    FileHdf5 * file = nullptr;
-
-    if (throttle_node_files_) {
-      if (FileHdf5::file_list[file_name] == nullptr) {
-        FileHdf5::file_list[file_name] = new FileHdf5 ("./",file_name);
-#ifdef DEBUG_THROTTLE      
-        CkPrintf ("%d %g DEBUG_THROTTLE opening %s\n",
-                  CkMyPe(),cello::simulation()->timer(),file_name.c_str());
-        fflush(stdout);
-#endif
-        FileHdf5::file_list[file_name]->file_open();
-        throttle_delay_();
-      }
-      file = FileHdf5::file_list[file_name];
-    } else {
-      file =  new FileHdf5 ("./",file_name);
-#ifdef DEBUG_THROTTLE      
-      CkPrintf ("%d %g DEBUG_THROTTLE opening %s\n",
-                CkMyPe(),cello::simulation()->timer(),file_name.c_str());
-      fflush(stdout);
-#endif      
-      file->file_open();
-      throttle_delay_();
-    }
-
-    // Read the domain dimensions
-
     const int IX = field_coords_[index].find ("x");
     const int IY = field_coords_[index].find ("y");
-    const int IZ = field_coords_[index].find ("z");
-
-    ASSERT3 ("EnzoInitialMusic::enforce_block()",
-	    "bad field coordinates %d %d %d",
-	     IX,IY,IZ,
-	     ((IX<4)&&(IY<4)&&(IZ<4)) &&
-	     ((IX != IY) || (IY==-1 && IZ == -1)) &&
-	     ((IX != IY && IY != IZ) || (IZ == -1)));
-    
-    int m4[4] = {0};
+
     int type_data = type_unknown;
-    file-> data_open (field_datasets_[index], &type_data,
-		     m4,m4+1,m4+2,m4+3);
-    // compute cell widths
-    double h4[4] = {1};
-    h4[IX] = (upper_block[0] - lower_block[0]) / nx;
-    h4[IY] = (upper_block[1] - lower_block[1]) / ny;
-    h4[IZ] = (upper_block[2] - lower_block[2]) / nz;
-
-    // determine offsets
-    int o4[4] = {0};
-    o4[IX] = (lower_block[0] - lower_domain[0]) / h4[IX];
-    o4[IY] = (lower_block[1] - lower_domain[1]) / h4[IY];
-    o4[IZ] = (lower_block[2] - lower_domain[2]) / h4[IZ];
-
-    // adjust offsets if domain is larger than file input
-    // (e.g. to allow N=1024^3 using 512^3 input files
-    // for scaling tests)
-
-    if (o4[IX] >= m4[IX]) o4[IX] = o4[IX] % m4[IX];
-    if (o4[IY] >= m4[IY]) o4[IY] = o4[IY] % m4[IY];
-    if (o4[IZ] >= m4[IZ]) o4[IZ] = o4[IZ] % m4[IZ];
-
-    int n4[4] = {1};
-    n4[IX] = (upper_block[0] - lower_block[0]) / h4[IX];
-    n4[IY] = (upper_block[1] - lower_block[1]) / h4[IY];
-    n4[IZ] = (upper_block[2] - lower_block[2]) / h4[IZ];
-      
-    // open the dataspace
-    file-> data_slice
-      (m4[0],m4[1],m4[2],m4[3],
-       n4[0],n4[1],n4[2],n4[3],
-       o4[0],o4[1],o4[2],o4[3]);
-
-    // create memory space
-    file->mem_create (n4[IX],n4[IY],n4[IZ],
-		     n4[IX],n4[IY],n4[IZ],
-		     0,0,0);
-    
+    int n4[4];
+    double h4[4];
+
     // input domain size
     union {
       void   * data;
       float  * data_float;
       double * data_double;
     };
-    
-    if (type_data == type_single) {
-      data_float = new float [nx*ny*nz];
-    } else if (type_data == type_double) {
-      data_double = new double [nx*ny*nz];
-    } else {
-      ERROR3 ("EnzoInitialMusic::enforce_block()",
-	      "Unsupported data type %d in file %s field %s",
-	      type_data,file_name.c_str(),field_datasets_[index].c_str());
-    }
 
-    file->data_read (data);
+    data = read_block_data_
+      (block,hierarchy,field_files_[index],field_datasets_[index],
+       field_coords_[index],&type_data,n4,h4);
 
     enzo_float * array = (enzo_float *) field.values(field_names_[index]);
 
@@ -240,121 +175,23 @@ void EnzoInitialMusic::enforce_block
     } else if (type_data == type_double) {
       delete [] data_double;
     }
-    
-    file->data_close();
-
-    const bool can_close = (++close_count[file_name] == throttle_close_count_);
-    const bool do_close = (throttle_node_files_ && can_close)
-      ||                  (! throttle_node_files_);
-    
-    if ( do_close ) {
-      close_count[file_name] = 0;
-      file->file_close();
-      throttle_delay_();
-      FileHdf5::file_list.erase(file_name);
-#ifdef DEBUG_THROTTLE
-      CkPrintf ("%d %g DEBUG_THROTTLE closed %s\n",
-                CkMyPe(),cello::simulation()->timer(),file_name.c_str());
-      fflush(stdout);
-#endif    
-    }    
-
-    if (throttle_intranode_) {
-      CmiUnlock(throttle_node_lock);
-    }
-
-
   }
 
   for (size_t index=0; index<particle_files_.size(); index++) {
 
-    std::string file_name = particle_files_[index];
-
-    if (throttle_intranode_) {
-      CmiLock(throttle_node_lock);
-    }
-
-    FileHdf5 * file = nullptr;
-
-    if (throttle_node_files_) {
-
-      if (FileHdf5::file_list[file_name] == nullptr) {
-
-        FileHdf5::file_list[file_name] = new FileHdf5 ("./",file_name);
-#ifdef DEBUG_THROTTLE      
-        CkPrintf ("%d %g DEBUG_THROTTLE opening %s\n",
-                  CkMyPe(),cello::simulation()->timer(),file_name.c_str());
-        fflush(stdout);
-#endif      
-        FileHdf5::file_list[file_name]->file_open();
-        throttle_delay_();
-      }
-
-      file = FileHdf5::file_list[file_name];
-        
-    } else {
-
-      file =  new FileHdf5 ("./",file_name);
-
-#ifdef DEBUG_THROTTLE      
-      CkPrintf ("%d %g DEBUG_THROTTLE opening %s\n",
-                CkMyPe(),cello::simulation()->timer(),file_name.c_str());
-#endif      
-      file->file_open();
-      throttle_delay_();
-    }
-
-    // Open the dataset
-    int m4[4] = {0};
-    int type_data = type_unknown;
-    file-> data_open (particle_datasets_[index], &type_data,
-		     m4,m4+1,m4+2,m4+3);
-
     // Block size
 
-    int mx,my,mz;
     int nx,ny,nz;
-    int gx,gy,gz;
- 
-    field.dimensions (0,&mx,&my,&mz);
-    field.size         (&nx,&ny,&nz);
-    field.ghost_depth(0,&gx,&gy,&gz);
+    field.size (&nx,&ny,&nz);
 
     // coordinate mapping
     const int IX = particle_coords_[index].find ("x");
     const int IY = particle_coords_[index].find ("y");
     const int IZ = particle_coords_[index].find ("z");
 
-    // compute cell widths
-    double h4[4] = {1};
-    h4[IX] = (upper_block[0] - lower_block[0]) / nx;
-    h4[IY] = (upper_block[1] - lower_block[1]) / ny;
-    h4[IZ] = (upper_block[2] - lower_block[2]) / nz;
-
-    // determine offsets
-    int o4[4] = {0};
-    o4[IX] = (lower_block[0] - lower_domain[0]) / h4[IX];
-    o4[IY] = (lower_block[1] - lower_domain[1]) / h4[IY];
-    o4[IZ] = (lower_block[2] - lower_domain[2]) / h4[IZ];
-
-    if (o4[IX] >= m4[IX]) o4[IX] = o4[IX] % m4[IX];
-    if (o4[IY] >= m4[IY]) o4[IY] = o4[IY] % m4[IY];
-    if (o4[IZ] >= m4[IZ]) o4[IZ] = o4[IZ] % m4[IZ];
-
-    int n4[4] = {1};
-    n4[IX] = (upper_block[0] - lower_block[0]) / h4[IX];
-    n4[IY] = (upper_block[1] - lower_block[1]) / h4[IY];
-    n4[IZ] = (upper_block[2] - lower_block[2]) / h4[IZ];
-
-    // open the dataspace
-    file-> data_slice
-      (m4[0],m4[1],m4[2],m4[3],
-       n4[0],n4[1],n4[2],n4[3],
-       o4[0],o4[1],o4[2],o4[3]);
-
-    // create memory space
-
-    file->mem_create (nx,ny,nz,nx,ny,nz,0,0,0);
+    int type_data = type_unknown;
+    int n4[4];
+    double h4[4];
 
     // input domain size
     union {
@@ -363,42 +200,10 @@ void EnzoInitialMusic::enforce_block
       double * data_double;
     };
 
-    if (type_data == type_single) {
-      data_float = new float [nx*ny*nz];
-    } else if (type_data == type_double) {
-      data_double = new double [nx*ny*nz];
-    } else {
-      ERROR3 ("EnzoInitialMusic::enforce_block()",
-	      "Unsupported data type %d in file %s particle dataset %s",
-	      type_data,file_name.c_str(),particle_datasets_[index].c_str());
-    }
-    
-    // read data and close file unless throttling
-    file->data_read (data);
-
-    file->data_close();
-
-    const bool can_close = (++close_count[file_name] == throttle_close_count_);
-    const bool do_close = (throttle_node_files_ && can_close)
-      ||                  (! throttle_node_files_);
-    
-    if ( do_close ) {
-      close_count[file_name] = 0;
-      file->file_close();
-      delete file;
-      throttle_delay_();
-      FileHdf5::file_list.erase(file_name);
-#ifdef DEBUG_THROTTLE
-      CkPrintf ("%d %g DEBUG_THROTTLE closed %s\n",
-                CkMyPe(),cello::simulation()->timer(),file_name.c_str());
-      fflush(stdout);
-#endif    
-    } 
+    data = read_block_data_
+      (block,hierarchy,particle_files_[index],particle_datasets_[index],
+       particle_coords_[index],&type_data,n4,h4);
 
-    if (throttle_intranode_) {
-      CmiUnlock(throttle_node_lock);
-    }
-    
     // Create particles and initialize them
 
     Particle particle = block->data()->particle();
@@ -542,6 +347,345 @@ void EnzoInitialMusic::enforce_block
 
 //----------------------------------------------------------------------
 
+void EnzoInitialMusic::enforce_done() throw()
+{
+  if (! staged_) return;
+
+  CmiLock(throttle_node_lock);
+  music_datasets.clear();
+  CmiUnlock(throttle_node_lock);
+}
+
+//----------------------------------------------------------------------
+
+void * EnzoInitialMusic::read_block_data_
+(Block * block, const Hierarchy * hierarchy,
+ const std::string & file_name,
+ const std::string & dataset,
+ const std::string & coords,
+ int * type_data, int n4[4], double h4[4])
+{
+  // Get the grid size at level_
+  double lower_domain[3];
+  double upper_domain[3];
+  hierarchy->lower(lower_domain, lower_domain+1, lower_domain+2);
+  hierarchy->upper(upper_domain, upper_domain+1, upper_domain+2);
+
+  double lower_block[3];
+  double upper_block[3];
+  block->lower(lower_block, lower_block+1, lower_block+2);
+  block->upper(upper_block, upper_block+1, upper_block+2);
+
+  int nx,ny,nz;
+  block->data()->field().size(&nx,&ny,&nz);
+
+  const int IX = coords.find ("x");
+  const int IY = coords.find ("y");
+  const int IZ = coords.find ("z");
+
+  ASSERT3 ("EnzoInitialMusic::read_block_data_()",
+           "bad coordinates %d %d %d",
+           IX,IY,IZ,
+           ((IX<4)&&(IY<4)&&(IZ<4)) &&
+           ((IX != IY) || (IY==-1 && IZ == -1)) &&
+           ((IX != IY && IY != IZ) || (IZ == -1)));
+
+  // Open the file, or get the dataset dimensions from the cache
+
+  if (staged_ || throttle_intranode_) {
+    CmiLock(throttle_node_lock);
+  }
+
+  FileHdf5 * file = nullptr;
+  int m4[4] = {0};
+  (*type_data) = type_unknown;
+
+  const std::string key = file_name + ":" + dataset;
+
+  if (staged_ && music_datasets.find(key) != music_datasets.end()) {
+
+    const MusicDataset & music_dataset = music_datasets[key];
+    (*type_data) = music_dataset.type;
+    for (int i=0; i<4; i++) m4[i] = music_dataset.m4[i];
+
+  } else {
+
+    if (throttle_node_files_ && ! staged_) {
+      if (FileHdf5::file_list[file_name] == nullptr) {
+        FileHdf5::file_list[file_name] = new FileHdf5 ("./",file_name);
+#ifdef DEBUG_THROTTLE      
+        CkPrintf ("%d %g DEBUG_THROTTLE opening %s\n",
+                  CkMyPe(),cello::simulation()->timer(),file_name.c_str());
+        fflush(stdout);
+#endif
+        FileHdf5::file_list[file_name]->file_open();
+        throttle_delay_();
+      }
+      file = FileHdf5::file_list[file_name];
+    } else {
+      file =  new FileHdf5 ("./",file_name);
+#ifdef DEBUG_THROTTLE      
+      CkPrintf ("%d %g DEBUG_THROTTLE opening %s\n",
+                CkMyPe(),cello::simulation()->timer(),file_name.c_str());
+      fflush(stdout);
+#endif      
+      file->file_open();
+      throttle_delay_();
+    }
+
+    file-> data_open (dataset, type_data, m4,m4+1,m4+2,m4+3);
+
+    if (staged_) {
+      MusicDataset & music_dataset = music_datasets[key];
+      music_dataset.type = (*type_data);
+      for (int i=0; i<4; i++) music_dataset.m4[i] = m4[i];
+    }
+  }
+
+  // compute cell widths
+  for (int i=0; i<4; i++) h4[i] = 1.0;
+  h4[IX] = (upper_block[0] - lower_block[0]) / nx;
+  h4[IY] = (upper_block[1] - lower_block[1]) / ny;
+  h4[IZ] = (upper_block[2] - lower_block[2]) / nz;
+
+  // determine offsets
+  int o4[4] = {0};
+  o4[IX] = (lower_block[0] - lower_domain[0]) / h4[IX];
+  o4[IY] = (lower_block[1] - lower_domain[1]) / h4[IY];
+  o4[IZ] = (lower_block[2] - lower_domain[2]) / h4[IZ];
+
+  // adjust offsets if domain is larger than file input
+  // (e.g. to allow N=1024^3 using 512^3 input files
+  // for scaling tests)
+
+  if (o4[IX] >= m4[IX]) o4[IX] = o4[IX] % m4[IX];
+  if (o4[IY] >= m4[IY]) o4[IY] = o4[IY] % m4[IY];
+  if (o4[IZ] >= m4[IZ]) o4[IZ] = o4[IZ] % m4[IZ];
+
+  n4[0] = 1;
+  n4[1] = n4[2] = n4[3] = 0;
+  n4[IX] = (upper_block[0] - lower_block[0]) / h4[IX];
+  n4[IY] = (upper_block[1] - lower_block[1]) / h4[IY];
+  n4[IZ] = (upper_block[2] - lower_block[2]) / h4[IZ];
+
+  void * data = nullptr;
+
+  if ((*type_data) == type_single) {
+    data = new float [nx*ny*nz];
+  } else if ((*type_data) == type_double) {
+    data = new double [nx*ny*nz];
+  } else {
+    ERROR3 ("EnzoInitialMusic::read_block_data_()",
+	    "Unsupported data type %d in file %s dataset %s",
+	    (*type_data),file_name.c_str(),dataset.c_str());
+  }
+
+  if (staged_) {
+
+    // Copy from the slab containing the Block, reading it if needed
+
+    if (file) {
+      file->data_close();
+      file->file_close();
+      delete file;
+    }
+
+    // Bound the slab along the fastest-varying axis by the root-level
+    // Blocks in the Block's row that are mapped to this node, or read
+    // the whole row if the Block is outside them
+
+    const int IF = std::max(IX,std::max(IY,IZ));
+    const int axis = (IF == IX) ? 0 : ((IF == IY) ? 1 : 2);
+    int lower_slab, upper_slab;
+    staged_range_(block,hierarchy,axis,h4[IF],&lower_slab,&upper_slab);
+    if (lower_slab > o4[IF] || upper_slab < o4[IF] + n4[IF] ||
+        upper_slab > m4[IF]) {
+      lower_slab = 0;
+      upper_slab = m4[IF];
+    }
+
+    const int bytes = cello::type_bytes[*type_data];
+    const MusicSlab & slab = staged_slab_
+      (key,file_name,dataset,IF,lower_slab,upper_slab,o4,n4);
+
+    int s4[4], d4[4], b4[4];
+    for (int i=0; i<4; i++) {
+      s4[i] = std::max(slab.n4[i],1);
+      b4[i] = std::max(n4[i],1);
+      d4[i] = o4[i] - slab.o4[i];
+    }
+
+    char * dst = (char *) data;
+    for (int i0=0; i0<b4[0]; i0++) {
+      for (int i1=0; i1<b4[1]; i1++) {
+        for (int i2=0; i2<b4[2]; i2++) {
+          const int i = (((i0+d4[0])*s4[1] + (i1+d4[1]))*s4[2]
+                         + (i2+d4[2]))*s4[3] + d4[3];
+          memcpy (dst, slab.data.data() + i*bytes, b4[3]*bytes);
+          dst += b4[3]*bytes;
+        }
+      }
+    }
+
+    CmiUnlock(throttle_node_lock);
+
+    return data;
+  }
+
+  // open the dataspace
+  file-> data_slice
+    (m4[0],m4[1],m4[2],m4[3],
+     n4[0],n4[1],n4[2],n4[3],
+     o4[0],o4[1],o4[2],o4[3]);
+
+  // create memory space
+  file->mem_create (n4[IX],n4[IY],n4[IZ],
+		    n4[IX],n4[IY],n4[IZ],
+		    0,0,0);
+
+  file->data_read (data);
+
+  file->data_close();
+
+  const bool can_close = (++close_count[file_name] == throttle_close_count_);
+  const bool do_close = (throttle_node_files_ && can_close)
+    ||                  (! throttle_node_files_);
+    
+  if ( do_close ) {
+    close_count[file_name] = 0;
+    file->file_close();
+    delete file;
+    throttle_delay_();
+    FileHdf5::file_list.erase(file_name);
+#ifdef DEBUG_THROTTLE
+    CkPrintf ("%d %g DEBUG_THROTTLE closed %s\n",
+              CkMyPe(),cello::simulation()->timer(),file_name.c_str());
+    fflush(stdout);
+#endif    
+  }    
+
+  if (throttle_intranode_) {
+    CmiUnlock(throttle_node_lock);
+  }
+
+  return data;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoInitialMusic::staged_range_
+(Block * block, const Hierarchy * hierarchy, int axis, double h,
+ int * lower, int * upper) const
+{
+  int nb3[3] = {1,1,1};
+  hierarchy->root_blocks(nb3,nb3+1,nb3+2);
+
+  double lower_domain[3];
+  double upper_domain[3];
+  hierarchy->lower(lower_domain, lower_domain+1, lower_domain+2);
+  hierarchy->upper(upper_domain, upper_domain+1, upper_domain+2);
+
+  // cells along axis in a root-level Block at the Block's resolution
+  const int n_root =
+    (upper_domain[axis] - lower_domain[axis]) / nb3[axis] / h + 0.5;
+
+  int ib3[3];
+  block->index().array(ib3,ib3+1,ib3+2);
+
+  CkLocMgr * loc_mgr = block->proxy_array().ckLocMgr();
+
+  int ib_lower = nb3[axis];
+  int ib_upper = 0;
+  for (int ib=0; ib<nb3[axis]; ib++) {
+    int jb3[3] = {ib3[0],ib3[1],ib3[2]};
+    jb3[axis] = ib;
+    Index index_root(jb3[0],jb3[1],jb3[2]);
+    const int ip = loc_mgr->homePe(CkArrayIndexIndex(index_root));
+    if (CkNodeOf(ip) == CkMyNode()) {
+      ib_lower = std::min(ib_lower,ib);
+      ib_upper = std::max(ib_upper,ib+1);
+    }
+  }
+
+  (*lower) = ib_lower * n_root;
+  (*upper) = ib_upper * n_root;
+}
+
+//----------------------------------------------------------------------
+
+const MusicSlab & EnzoInitialMusic::staged_slab_
+(const std::string & key,
+ const std::string & file_name,
+ const std::string & dataset,
+ int IF, int lower, int upper, const int o4[4], const int n4[4])
+{
+  // A slab spans [lower,upper) along the fastest-varying spatial axis
+  // IF, and the Block's extent along the others, so its rows are
+  // contiguous in the file
+
+  MusicDataset & music_dataset = music_datasets[key];
+  const int * m4 = music_dataset.m4;
+
+  std::array<int,4> so4 = {{o4[0],o4[1],o4[2],o4[3]}};
+  int sn4[4] = {n4[0],n4[1],n4[2],n4[3]};
+  so4[IF] = lower;
+  sn4[IF] = upper - lower;
+
+  const std::array<int,5> key_slab =
+    {{so4[0],so4[1],so4[2],so4[3],sn4[IF]}};
+
+  auto it_slab = music_dataset.slabs.find(key_slab);
+
+  if (it_slab == music_dataset.slabs.end()) {
+
+    // Evict the least-recently used slab if at the limit
+
+    if (staged_slabs_ > 0 &&
+        (int)music_dataset.slabs.size() >= staged_slabs_) {
+      auto it_old = music_dataset.slabs.begin();
+      for (auto it = music_dataset.slabs.begin();
+           it != music_dataset.slabs.end(); ++it) {
+        if (it->second.last_use < it_old->second.last_use) it_old = it;
+      }
+      music_dataset.slabs.erase(it_old);
+    }
+
+    MusicSlab & slab = music_dataset.slabs[key_slab];
+
+    int count = 1;
+    for (int i=0; i<4; i++) {
+      slab.o4[i] = so4[i];
+      slab.n4[i] = sn4[i];
+      count *= std::max(sn4[i],1);
+    }
+    slab.data.resize(count*cello::type_bytes[music_dataset.type]);
+
+    FileHdf5 file ("./",file_name);
+    file.file_open();
+    throttle_delay_();
+    int type_data;
+    int mf4[4] = {0};
+    file.data_open (dataset, &type_data, mf4,mf4+1,mf4+2,mf4+3);
+    file.data_slice
+      (m4[0],  m4[1],  m4[2],  m4[3],
+       sn4[0], sn4[1], sn4[2], sn4[3],
+       so4[0], so4[1], so4[2], so4[3]);
+    file.mem_create (count,1,1,count,1,1,0,0,0);
+    file.data_read (slab.data.data());
+    file.mem_close();
+    file.data_close();
+    file.file_close();
+
+    it_slab = music_dataset.slabs.find(key_slab);
+  }
+
+  it_slab->second.last_use = ++music_slab_counter;
+
+  return it_slab->second;
+}
+
+//----------------------------------------------------------------------
+
 void EnzoInitialMusic::throttle_stagger_()
 {
   if (throttle_internode_) {
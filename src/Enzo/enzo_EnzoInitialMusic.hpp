@@ -8,6 +8,8 @@
 #ifndef ENZO_ENZO_INITIAL_MUSIC_HPP
 #define ENZO_ENZO_INITIAL_MUSIC_HPP
 
+struct MusicSlab;
+
 class EnzoInitialMusic : public Initial {
 
   /// @class    EnzoInitialMusic
@@ -46,6 +48,9 @@ public: // interface
   virtual void enforce_block
   ( Block * block, const Hierarchy * hierarchy ) throw();
 
+  /// Free the slabs cached for initializing Blocks
+  virtual void enforce_done() throw();
+
 protected: // functions
 
   /// If internode throttling enabled, sleep (i_noden * throttle_seconds_stagger_) seconds
@@ -54,6 +59,31 @@ protected: // functions
   /// If internode throttling enabled, sleep throttle_seconds_delay_ seconds after
   /// each open/close pair
   void throttle_delay_();
+
+  /// Read the Block's portion of a MUSIC dataset into a new array of
+  /// the dataset's type, returning the type, sizes, and cell widths
+  void * read_block_data_
+  (Block * block, const Hierarchy * hierarchy,
+   const std::string & file_name,
+   const std::string & dataset,
+   const std::string & coords,
+   int * type_data, int n4[4], double h4[4]);
+
+  /// Return the range [lower,upper) of cells along axis, at cell width
+  /// h, covered by the root-level Blocks in the Block's row along axis
+  /// that are mapped to this node
+  void staged_range_
+  (Block * block, const Hierarchy * hierarchy, int axis, double h,
+   int * lower, int * upper) const;
+
+  /// Return the cached slab of the dataset containing the hyperslab
+  /// (o4,n4) and spanning [lower,upper) along dataset axis IF, reading
+  /// it from the file if needed
+  const MusicSlab & staged_slab_
+  (const std::string & key,
+   const std::string & file_name,
+   const std::string & dataset,
+   int IF, int lower, int upper, const int o4[4], const int n4[4]);
   
   template <class T>
   void copy_field_data_to_array_
@@ -110,6 +140,13 @@ protected: // attributes
   /// if internode throttling, delay after each open/close pair
   double throttle_seconds_delay_;
 
+  /// Read slabs along the fastest-varying axis once per process and
+  /// copy Block data from them, instead of reading per Block
+  bool staged_;
+
+  /// Maximum number of slabs per dataset held in the process cache
+  int staged_slabs_;
+
 };
 
 #endif /* ENZO_ENZO_INITIAL_MUSIC_HPP */
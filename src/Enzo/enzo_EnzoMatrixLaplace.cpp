@@ -58,7 +58,7 @@ void EnzoMatrixLaplace::matvec_
   const int idy = mx_;
   const int idz = mx_*my_;
 
-  const int rank = cello::rank();
+  const int rank = rank_();
 
   if (order_ == 2) {
 
@@ -222,7 +222,7 @@ void EnzoMatrixLaplace::matvec_
 	      +    (c0*(X[i]) +
 		    c1*(X[i-idy] +X[i+idy]) +
 		    c2*(X[i-idy2]+X[i+idy2]) +
-		    c2*(X[i-idy3]+X[i+idy3])) * dy
+		    c3*(X[i-idy3]+X[i+idy3])) * dy
 	      +    (c0*(X[i]) +
 		    c1*(X[i-idz] +X[i+idz]) +
 		    c2*(X[i-idz2]+X[i+idz2]) +
@@ -242,7 +242,7 @@ void EnzoMatrixLaplace::matvec_
 
 void EnzoMatrixLaplace::diagonal_ (enzo_float * X, int g0) const throw()
 {
-  const int rank = cello::rank();
+  const int rank = rank_();
 
   if (order_ == 2) {
     
@@ -362,3 +362,272 @@ void EnzoMatrixLaplace::diagonal_ (enzo_float * X, int g0) const throw()
   
 }
 
+//======================================================================
+
+template <int R>
+void EnzoMatrixLaplace::stencil_ (enzo_float c[R+1], double h) const throw()
+{
+  // Second-, fourth- and sixth-order central differences
+
+  const double h2 = h*h;
+  if (R == 1) {
+    c[0] = -2.0 / h2;
+    c[1] =  1.0 / h2;
+  } else if (R == 2) {
+    c[0] = -30.0 / (12.0*h2);
+    c[1] =  16.0 / (12.0*h2);
+    c[2] =  -1.0 / (12.0*h2);
+  } else {
+    c[0] = -2720.0 / (1080.0*h2);
+    c[1] =  1455.0 / (1080.0*h2);
+    c[2] =   -96.0 / (1080.0*h2);
+    c[3] =     1.0 / (1080.0*h2);
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <int RANK, int R>
+void EnzoMatrixLaplace::jacobi_sweep_
+(enzo_float * X, const enzo_float * B, enzo_float * T, double weight,
+ const int l3[3], const int u3[3]) const throw()
+{
+  enzo_float cx[R+1], cy[R+1], cz[R+1];
+  for (int k=0; k<=R; k++) cy[k] = cz[k] = 0.0;
+  stencil_<R>(cx,hx_);
+  if (RANK >= 2) stencil_<R>(cy,hy_);
+  if (RANK >= 3) stencil_<R>(cz,hz_);
+
+  // The diagonal is constant, so X += w*(B - A*X)/d is computed
+  // without storing D
+
+  const enzo_float d = cx[0] + cy[0] + cz[0];
+  const enzo_float wd = weight / d;
+
+  const int idy = mx_;
+  const int idz = mx_*my_;
+
+  const int ix0 = l3[0];
+  const int ix1 = mx_ - u3[0];
+  const int iy0 = (RANK >= 2) ? l3[1] : 0;
+  const int iy1 = (RANK >= 2) ? my_ - u3[1] : 1;
+  const int iz0 = (RANK >= 3) ? l3[2] : 0;
+  const int iz1 = (RANK >= 3) ? mz_ - u3[2] : 1;
+
+  // Sweep through planes normal to the outermost axis, storing the
+  // correction for plane p in T and adding it to X once the
+  // correction for plane p+R is computed.  Plane p+R is the last
+  // plane whose stencil reads X in plane p, so the planes in flight
+  // stay in cache and X and B are each streamed through once
+
+  const int ip0 = (RANK == 3) ? iz0 : ((RANK == 2) ? iy0 : ix0);
+  const int ip1 = (RANK == 3) ? iz1 : ((RANK == 2) ? iy1 : ix1);
+
+  for (int ip=ip0; ip<ip1+R; ip++) {
+
+    if (ip < ip1) {
+      const int jz0 = (RANK == 3) ? ip : iz0;
+      const int jz1 = (RANK == 3) ? ip+1 : iz1;
+      const int jy0 = (RANK == 2) ? ip : iy0;
+      const int jy1 = (RANK == 2) ? ip+1 : iy1;
+      const int jx0 = (RANK == 1) ? ip : ix0;
+      const int jx1 = (RANK == 1) ? ip+1 : ix1;
+      for (int iz=jz0; iz<jz1; iz++) {
+	for (int iy=jy0; iy<jy1; iy++) {
+	  const int i0 = mx_*(iy + my_*iz);
+	  const enzo_float * xr = X + i0;
+	  const enzo_float * br = B + i0;
+	  enzo_float * tr = T + i0;
+	  ENZO_SIMD_LOOP
+	  for (int ix=jx0; ix<jx1; ix++) {
+	    const enzo_float * xp = xr + ix;
+	    enzo_float ax = d*xp[0];
+	    for (int k=1; k<=R; k++) {
+	      ax += cx[k]*(xp[-k] + xp[k]);
+	      if (RANK >= 2) ax += cy[k]*(xp[-k*idy] + xp[k*idy]);
+	      if (RANK >= 3) ax += cz[k]*(xp[-k*idz] + xp[k*idz]);
+	    }
+	    tr[ix] = wd*(br[ix] - ax);
+	  }
+	}
+      }
+    }
+
+    const int iq = ip - R;
+
+    if (iq >= ip0) {
+      const int jz0 = (RANK == 3) ? iq : iz0;
+      const int jz1 = (RANK == 3) ? iq+1 : iz1;
+      const int jy0 = (RANK == 2) ? iq : iy0;
+      const int jy1 = (RANK == 2) ? iq+1 : iy1;
+      const int jx0 = (RANK == 1) ? iq : ix0;
+      const int jx1 = (RANK == 1) ? iq+1 : ix1;
+      for (int iz=jz0; iz<jz1; iz++) {
+	for (int iy=jy0; iy<jy1; iy++) {
+	  const int i0 = mx_*(iy + my_*iz);
+	  enzo_float * xr = X + i0;
+	  const enzo_float * tr = T + i0;
+	  ENZO_SIMD_LOOP
+	  for (int ix=jx0; ix<jx1; ix++) {
+	    xr[ix] += tr[ix];
+	  }
+	}
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <int RANK, int R>
+long double EnzoMatrixLaplace::matvec_dot_
+(enzo_float * Y, const enzo_float * X, const enzo_float * W,
+ int g0, const int gd3[3]) const throw()
+{
+  enzo_float cx[R+1], cy[R+1], cz[R+1];
+  for (int k=0; k<=R; k++) cy[k] = cz[k] = 0.0;
+  stencil_<R>(cx,hx_);
+  if (RANK >= 2) stencil_<R>(cy,hy_);
+  if (RANK >= 3) stencil_<R>(cz,hz_);
+
+  const enzo_float d = cx[0] + cy[0] + cz[0];
+
+  const int idy = mx_;
+  const int idz = mx_*my_;
+
+  g0 = std::max(R,g0);
+
+  // Y is computed on cells at least g0 from the Block edges, and
+  // DOT(Y,W) is accumulated on the Block interior while the row of
+  // Y is still in cache
+
+  const int iy0 = (RANK >= 2) ? g0 : 0;
+  const int iy1 = (RANK >= 2) ? my_ - g0 : 1;
+  const int iz0 = (RANK >= 3) ? g0 : 0;
+  const int iz1 = (RANK >= 3) ? mz_ - g0 : 1;
+
+  const int kx0 = gd3[0];
+  const int kx1 = mx_ - gd3[0];
+  const int ky0 = (RANK >= 2) ? gd3[1] : 0;
+  const int ky1 = (RANK >= 2) ? my_ - gd3[1] : 1;
+  const int kz0 = (RANK >= 3) ? gd3[2] : 0;
+  const int kz1 = (RANK >= 3) ? mz_ - gd3[2] : 1;
+
+  long double sum = 0.0;
+
+  for (int iz=iz0; iz<iz1; iz++) {
+    for (int iy=iy0; iy<iy1; iy++) {
+      const int i0 = mx_*(iy + my_*iz);
+      const enzo_float * xr = X + i0;
+      enzo_float * yr = Y + i0;
+      ENZO_SIMD_LOOP
+      for (int ix=g0; ix<mx_-g0; ix++) {
+	const enzo_float * xp = xr + ix;
+	enzo_float ax = d*xp[0];
+	for (int k=1; k<=R; k++) {
+	  ax += cx[k]*(xp[-k] + xp[k]);
+	  if (RANK >= 2) ax += cy[k]*(xp[-k*idy] + xp[k*idy]);
+	  if (RANK >= 3) ax += cz[k]*(xp[-k*idz] + xp[k*idz]);
+	}
+	yr[ix] = ax;
+      }
+      if (kz0 <= iz && iz < kz1 && ky0 <= iy && iy < ky1) {
+	const enzo_float * wr = W + i0;
+	double sum_row = 0.0;
+	for (int ix=kx0; ix<kx1; ix++) {
+	  sum_row += yr[ix]*wr[ix];
+	}
+	sum += sum_row;
+      }
+    }
+  }
+  return sum;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMatrixLaplace::jacobi_sweep
+(int i_x, int i_b, int i_r, int i_d, double weight, Block * block,
+ const int l3[3], const int u3[3]) throw()
+{
+  Field field = block->data()->field();
+
+  field.dimensions(0,&mx_,&my_,&mz_);
+  block->cell_width (&hx_,&hy_,&hz_);
+
+  jacobi_sweep (precision_type(field.precision(i_x)), field.values(i_x),
+		field.values(i_b), field.values(i_r), weight, l3, u3);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMatrixLaplace::jacobi_sweep
+(precision_type precision, void * x, const void * b, void * t,
+ double weight, const int l3[3], const int u3[3]) throw()
+{
+  enzo_float * X = (enzo_float *) x;
+  const enzo_float * B = (const enzo_float *) b;
+  enzo_float * T = (enzo_float *) t;
+
+  const int rank = rank_();
+  const int r = ghost_depth();
+
+  if (rank == 1) {
+    if      (r == 1) jacobi_sweep_<1,1>(X,B,T,weight,l3,u3);
+    else if (r == 2) jacobi_sweep_<1,2>(X,B,T,weight,l3,u3);
+    else             jacobi_sweep_<1,3>(X,B,T,weight,l3,u3);
+  } else if (rank == 2) {
+    if      (r == 1) jacobi_sweep_<2,1>(X,B,T,weight,l3,u3);
+    else if (r == 2) jacobi_sweep_<2,2>(X,B,T,weight,l3,u3);
+    else             jacobi_sweep_<2,3>(X,B,T,weight,l3,u3);
+  } else {
+    if      (r == 1) jacobi_sweep_<3,1>(X,B,T,weight,l3,u3);
+    else if (r == 2) jacobi_sweep_<3,2>(X,B,T,weight,l3,u3);
+    else             jacobi_sweep_<3,3>(X,B,T,weight,l3,u3);
+  }
+}
+
+//----------------------------------------------------------------------
+
+long double EnzoMatrixLaplace::matvec_dot
+(int i_y, int i_x, int i_w, Block * block, int g0) throw()
+{
+  Field field = block->data()->field();
+
+  field.dimensions(0,&mx_,&my_,&mz_);
+  block->cell_width (&hx_,&hy_,&hz_);
+  int gd3[3];
+  field.ghost_depth(0,&gd3[0],&gd3[1],&gd3[2]);
+
+  return matvec_dot (precision_type(field.precision(i_y)),
+		     field.values(i_y), field.values(i_x),
+		     field.values(i_w), g0, gd3);
+}
+
+//----------------------------------------------------------------------
+
+long double EnzoMatrixLaplace::matvec_dot
+(precision_type precision, void * y, const void * x, const void * w,
+ int g0, const int gd3[3]) throw()
+{
+  enzo_float * Y = (enzo_float *) y;
+  const enzo_float * X = (const enzo_float *) x;
+  const enzo_float * W = (const enzo_float *) w;
+
+  const int rank = rank_();
+  const int r = ghost_depth();
+
+  if (rank == 1) {
+    if      (r == 1) return matvec_dot_<1,1>(Y,X,W,g0,gd3);
+    else if (r == 2) return matvec_dot_<1,2>(Y,X,W,g0,gd3);
+    else             return matvec_dot_<1,3>(Y,X,W,g0,gd3);
+  } else if (rank == 2) {
+    if      (r == 1) return matvec_dot_<2,1>(Y,X,W,g0,gd3);
+    else if (r == 2) return matvec_dot_<2,2>(Y,X,W,g0,gd3);
+    else             return matvec_dot_<2,3>(Y,X,W,g0,gd3);
+  } else {
+    if      (r == 1) return matvec_dot_<3,1>(Y,X,W,g0,gd3);
+    else if (r == 2) return matvec_dot_<3,2>(Y,X,W,g0,gd3);
+    else             return matvec_dot_<3,3>(Y,X,W,g0,gd3);
+  }
+}
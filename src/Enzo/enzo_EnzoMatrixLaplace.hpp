@@ -76,7 +76,16 @@ public: // interface
     hy_ = hy;
     hz_ = hz;
   }
-  
+
+  /// Set array dimensions, including ghost zones.  Required for
+  /// lower-level methods that don't have access to the Block
+  void set_dimensions (int mx, int my, int mz)
+  {
+    mx_ = mx;
+    my_ = my;
+    mz_ = mz;
+  }
+
 public: // virtual functions
 
   /// Apply the matrix to a vector Y <-- A*X
@@ -99,12 +108,56 @@ public: // virtual functions
   virtual int ghost_depth() const throw()
   { return (order_ == 2) ? 1 : ( (order_ == 4) ? 2 : 3); }
 
+  /// Fused weighted Jacobi sweep.  The diagonal is constant so is not
+  /// stored, and only the scratch field ir is used
+  virtual void jacobi_sweep (int ix, int ib, int ir, int id,
+			     double weight, Block * block,
+			     const int l3[3], const int u3[3]) throw();
+
+  /// Low-level fused weighted Jacobi sweep X <-- X + w*(B - A*X)/D
+  /// using scratch array t.  Must call set_cell_width and
+  /// set_dimensions first
+  void jacobi_sweep (precision_type precision,
+		     void * x, const void * b, void * t, double weight,
+		     const int l3[3], const int u3[3]) throw();
+
+  /// Fused matvec and dot product
+  virtual long double matvec_dot (int iy, int ix, int iw,
+				  Block * block, int g0=1) throw();
+
+  /// Low-level fused Y <-- A*X returning DOT(Y,W) over cells at least
+  /// gd3[] cells from the array edges.  Must call set_cell_width and
+  /// set_dimensions first
+  long double matvec_dot (precision_type precision,
+			  void * y, const void * x, const void * w,
+			  int g0, const int gd3[3]) throw();
+
 protected: // functions
 
+  /// Rank of the arrays, from their dimensions since axes beyond the
+  /// rank have no ghost zones
+  int rank_ () const throw()
+  { return (mz_ > 1) ? 3 : ((my_ > 1) ? 2 : 1); }
+
   void matvec_ (enzo_float * Y, enzo_float * X, int g0) const throw();
 
   void diagonal_ (enzo_float * X, int g0) const throw();
 
+  /// Return the stencil coefficients along each axis c[0..R] for the
+  /// axis with cell width h, scaled by 1/h^2
+  template <int R>
+  void stencil_ (enzo_float c[R+1], double h) const throw();
+
+  template <int RANK, int R>
+  void jacobi_sweep_ (enzo_float * X, const enzo_float * B, enzo_float * T,
+		      double weight,
+		      const int l3[3], const int u3[3]) const throw();
+
+  template <int RANK, int R>
+  long double matvec_dot_ (enzo_float * Y, const enzo_float * X,
+			   const enzo_float * W, int g0,
+			   const int gd3[3]) const throw();
+
 protected: // attributes
 
   int mx_, my_, mz_;
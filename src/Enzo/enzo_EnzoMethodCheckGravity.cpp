@@ -13,6 +13,10 @@ EnzoMethodCheckGravity::EnzoMethodCheckGravity ( std::string particle_type ) thr
   : Method (),
     particle_type_(particle_type)
 {
+  // compute() only reads the velocity fields (interpolating them to
+  // particle positions); it modifies no fields
+  set_modified_fields({});
+
   cello::simulation()->new_refresh_set_name(ir_post_,name());
 
   Refresh * refresh = cello::refresh(ir_post_);
@@ -31,6 +31,17 @@ EnzoMethodComovingExpansion::EnzoMethodComovingExpansion
   // define required fields if they do not exist
   this->define_fields();
 
+  // old values are used for time-centering if Field:history is set
+  const int num_history = cello::config()->field_history;
+  if (num_history > 0) {
+    FieldDescr * field_descr = cello::field_descr();
+    bool added_history = false;
+    for (const std::string & field : this->required_fields_) {
+      if (field_descr->add_history_field(field)) added_history = true;
+    }
+    if (added_history) field_descr->reset_history(num_history);
+  }
+
   Refresh * refresh = cello::refresh(ir_post_);
   refresh->add_field("density");
   refresh->add_field("total_energy");
@@ -88,6 +99,15 @@ void EnzoMethodComovingExpansion::compute ( Block * block) throw()
 
       int has_history = ((field.num_history() > 0) &&
   			 (field.history_time(1) > 0.));
+      for (const std::string & field_name : this->required_fields_) {
+        has_history = has_history && field.has_history(field_name);
+      }
+      for (const std::string & field_name :
+             {"bfield_x", "bfield_y", "bfield_z"}) {
+        if (field.is_field(field_name)) {
+          has_history = has_history && field.has_history(field_name);
+        }
+      }
       enzo_float compute_time;
       if (has_history) {
   	compute_time = 0.5 * (enzo_block->time() +
@@ -11,10 +11,12 @@
 
 //----------------------------------------------------------------------
 
-EnzoMethodHeat::EnzoMethodHeat (double alpha, double courant)
+EnzoMethodHeat::EnzoMethodHeat (double alpha, double courant,
+                                bool overlap_refresh)
   : Method(),
     alpha_(alpha),
-    courant_(courant)
+    courant_(courant),
+    it_new_(-1)
 {
 
   this->required_fields_ = std::vector<std::string> {"temperature"};
@@ -26,6 +28,12 @@ EnzoMethodHeat::EnzoMethodHeat (double alpha, double courant)
   Refresh * refresh = cello::refresh(ir_post_);
   refresh->add_field("temperature");
 
+  // the temporary is only used when overlapping the interior update
+  // with the refresh
+
+  if (overlap_refresh) {
+    it_new_ = cello::field_descr()->insert_temporary();
+  }
 }
 
 //----------------------------------------------------------------------
@@ -41,6 +49,7 @@ void EnzoMethodHeat::pup (PUP::er &p)
 
   p | alpha_;
   p | courant_;
+  p | it_new_;
 }
 
 //----------------------------------------------------------------------
@@ -53,8 +62,64 @@ void EnzoMethodHeat::compute ( Block * block) throw()
     Field field = block->data()->field();
 
     enzo_float * T = (enzo_float *) field.values ("temperature");
+    enzo_float * T_new = (it_new_ >= 0) ?
+      (enzo_float *) field.values (it_new_) : nullptr;
+
+    int mx,my,mz;
+    int gx,gy,gz;
+    field.dimensions  ("temperature",&mx,&my,&mz);
+    field.ghost_depth ("temperature",&gx,&gy,&gz);
+
+    if (T_new == nullptr) {
+
+      // update all cells in place
+
+      const int m = mx*my*mz;
+      enzo_float * U = new enzo_float [m];
+      for (int i=0; i<m; i++) U[i]=T[i];
+
+      compute_ (block,U,T,gx,mx-gx,gy,my-gy,gz,mz-gz);
+
+      delete [] U;
+
+    } else {
+
+      // interior cells were updated by compute_interior(): update
+      // cells adjacent to ghost zones, one layer per face, where the
+      // layers normal to y and z exclude cells in earlier layers
 
-    compute_ (block,T);
+      const int dx = (mx > 1) ? 1 : 0;
+      const int dy = (my > 1) ? 1 : 0;
+      const int dz = (mz > 1) ? 1 : 0;
+
+      const int ix0 = gx, ix1 = mx-gx;
+      const int iy0 = gy, iy1 = my-gy;
+      const int iz0 = gz, iz1 = mz-gz;
+
+      if (dx) {
+        compute_ (block,T,T_new,ix0,ix0+1,iy0,iy1,iz0,iz1);
+        compute_ (block,T,T_new,ix1-1,ix1,iy0,iy1,iz0,iz1);
+      }
+      if (dy) {
+        compute_ (block,T,T_new,ix0+dx,ix1-dx,iy0,iy0+1,iz0,iz1);
+        compute_ (block,T,T_new,ix0+dx,ix1-dx,iy1-1,iy1,iz0,iz1);
+      }
+      if (dz) {
+        compute_ (block,T,T_new,ix0+dx,ix1-dx,iy0+dy,iy1-dy,iz0,iz0+1);
+        compute_ (block,T,T_new,ix0+dx,ix1-dx,iy0+dy,iy1-dy,iz1-1,iz1);
+      }
+
+      for (int iz=iz0; iz<iz1; iz++) {
+        for (int iy=iy0; iy<iy1; iy++) {
+          for (int ix=ix0; ix<ix1; ix++) {
+            const int i = ix + mx*(iy + my*iz);
+            T[i] = T_new[i];
+          }
+        }
+      }
+
+      field.deallocate_temporary (it_new_);
+    }
   }
 
   block->compute_done();
@@ -62,6 +127,39 @@ void EnzoMethodHeat::compute ( Block * block) throw()
 
 //----------------------------------------------------------------------
 
+void EnzoMethodHeat::compute_interior ( Block * block) throw()
+{
+  if (! block->is_leaf() || it_new_ < 0) return;
+
+  Field field = block->data()->field();
+
+  int mx,my,mz;
+  int gx,gy,gz;
+  field.dimensions  ("temperature",&mx,&my,&mz);
+  field.ghost_depth ("temperature",&gx,&gy,&gz);
+
+  const int dx = (mx > 1) ? 1 : 0;
+  const int dy = (my > 1) ? 1 : 0;
+  const int dz = (mz > 1) ? 1 : 0;
+
+  // need at least one interior cell along each axis
+
+  if (mx-2*gx <= 2*dx || my-2*gy <= 2*dy || mz-2*gz <= 2*dz) return;
+
+  // temperature may still be read by neighbors, so store the updated
+  // values in a temporary field until compute() is called
+
+  field.allocate_temporary (it_new_);
+
+  const enzo_float * T = (const enzo_float *) field.values ("temperature");
+  enzo_float * T_new = (enzo_float *) field.values (it_new_);
+
+  compute_ (block,T,T_new,
+            gx+dx,mx-gx-dx, gy+dy,my-gy-dy, gz+dz,mz-gz-dz);
+}
+
+//----------------------------------------------------------------------
+
 double EnzoMethodHeat::timestep ( Block * block ) const throw()
 {
   // initialize_(block);
@@ -88,7 +186,9 @@ double EnzoMethodHeat::timestep ( Block * block ) const throw()
 
 //======================================================================
 
-void EnzoMethodHeat::compute_ (Block * block,enzo_float * Unew) const throw()
+void EnzoMethodHeat::compute_
+(Block * block, const enzo_float * U, enzo_float * Unew,
+ int i0, int i1, int j0, int j1, int k0, int k1) const throw()
 {
   Data * data = block->data();
   Field field   =      data->field();
@@ -96,10 +196,8 @@ void EnzoMethodHeat::compute_ (Block * block,enzo_float * Unew) const throw()
   const int id_temp_ = field.field_id ("temperature");
 
   int mx,my,mz;
-  int gx,gy,gz;
 
   field.dimensions  (id_temp_,&mx,&my,&mz);
-  field.ghost_depth (id_temp_,&gx,&gy,&gz);
 
   // Initialize array increments
   const int idx = 1;
@@ -115,18 +213,13 @@ void EnzoMethodHeat::compute_ (Block * block,enzo_float * Unew) const throw()
   double dyi = 1.0/(hy*hy);
   double dzi = 1.0/(hz*hz);
 
-  const int m = mx*my*mz;
-
   const int rank = ((mz == 1) ? ((my == 1) ? 1 : 2) : 3);
 
   const double dt = timestep(block);
 
-  enzo_float * U = new enzo_float [m];
-  for (int i=0; i<m; i++) U[i]=Unew[i];
-
   if (rank == 1) {
 
-    for (int ix=gx; ix<mx-gx; ix++) {
+    for (int ix=i0; ix<i1; ix++) {
 
       int i = ix;
 
@@ -138,8 +231,8 @@ void EnzoMethodHeat::compute_ (Block * block,enzo_float * Unew) const throw()
 
   } else if (rank == 2) {
 
-    for (int iy=gy; iy<my-gy; iy++) {
-      for (int ix=gy; ix<mx-gy; ix++) {
+    for (int iy=j0; iy<j1; iy++) {
+      for (int ix=i0; ix<i1; ix++) {
 
 	int i = ix + mx*iy;
 
@@ -153,9 +246,9 @@ void EnzoMethodHeat::compute_ (Block * block,enzo_float * Unew) const throw()
 
   } else if (rank == 3) {
 
-    for (int iz=gz; iz<mz-gz; iz++) {
-      for (int iy=gy; iy<my-gy; iy++) {
-	for (int ix=gx; ix<mx-gx; ix++) {
+    for (int iz=k0; iz<k1; iz++) {
+      for (int iy=j0; iy<j1; iy++) {
+	for (int ix=i0; ix<i1; ix++) {
 
 	  int i = ix + mx*(iy + my*iz);
 
@@ -170,6 +263,4 @@ void EnzoMethodHeat::compute_ (Block * block,enzo_float * Unew) const throw()
     }
   }
 
-  delete [] U;
-
 }
@@ -20,12 +20,13 @@ class EnzoMethodHeat : public Method {
 public: // interface
 
   /// Create a new EnzoMethodHeat object
-  EnzoMethodHeat(double alpha, double courant);
+  EnzoMethodHeat(double alpha, double courant, bool overlap_refresh);
 
   EnzoMethodHeat()
     : Method(),
       alpha_(0.0),
-      courant_(0.0)
+      courant_(0.0),
+      it_new_(-1)
   { }
 
   /// Charm++ PUP::able declarations
@@ -35,7 +36,8 @@ public: // interface
   EnzoMethodHeat (CkMigrateMessage *m)
     : Method (m),
       alpha_(0.0),
-      courant_(0.0)
+      courant_(0.0),
+      it_new_(-1)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -44,6 +46,10 @@ public: // interface
   /// Apply the method to advance a block one timestep 
   virtual void compute( Block * block) throw();
 
+  /// Update interior cells into a temporary field while the
+  /// temperature is being refreshed
+  virtual void compute_interior( Block * block) throw();
+
   virtual std::string name () throw () 
   { return "heat"; }
 
@@ -52,7 +58,10 @@ public: // interface
 
 protected: // methods
 
-  void compute_ (Block * block, enzo_float * Unew ) const throw();
+  /// Update Unew from U in the cells [i0,i1) x [j0,j1) x [k0,k1)
+  void compute_ (Block * block, const enzo_float * U, enzo_float * Unew,
+                 int i0, int i1, int j0, int j1, int k0, int k1)
+    const throw();
 
 protected: // attributes
 
@@ -61,6 +70,10 @@ protected: // attributes
 
   /// Courant safety number
   double courant_;
+
+  /// Temporary field for updated temperature when overlapping the
+  /// interior update with the refresh, or -1 if not overlapping
+  int it_new_;
 };
 
 #endif /* ENZO_ENZO_METHOD_HEAT_HPP */
@@ -50,8 +50,11 @@ EnzoMethodMHDVlct::EnzoMethodMHDVlct (std::string rsolver,
 				      double pressure_floor,
 				      std::string mhd_choice,
 				      bool dual_energy_formalism,
-				      double dual_energy_formalism_eta)
-  : Method()
+				      double dual_energy_formalism_eta,
+				      int tile_depth)
+  : Method(),
+    tile_depth_(tile_depth),
+    interior_map_()
 {
   // Initialize equation of state (check the validity of quantity floors)
   EnzoEquationOfState::check_floor(density_floor);
@@ -102,6 +105,9 @@ EnzoMethodMHDVlct::EnzoMethodMHDVlct (std::string rsolver,
   // scalars won't necessarily be known until after all Methods have been
   // constructed and all intializers have been executed
   refresh->add_all_fields();
+
+  // Report scratch arena statistics in the Performance counters
+  EnzoEFltArrayArena::instance()->new_counters();
 }
 
 //----------------------------------------------------------------------
@@ -208,6 +214,7 @@ void EnzoMethodMHDVlct::pup (PUP::er &p)
   p|integrable_field_list_;
   p|reconstructable_field_list_;
   p|lazy_passive_list_;
+  p|tile_depth_;
 }
 
 //----------------------------------------------------------------------
@@ -236,6 +243,40 @@ std::vector<std::string> unique_combination_(const std::vector<std::string> &a,
 
 //----------------------------------------------------------------------
 
+// Returns a new map holding views of the subarrays of the arrays in map for
+// each of keys (the returned map has its own table of keys)
+static EnzoEFltArrayMap select_subarrays_
+(const EnzoEFltArrayMap &map, const std::vector<std::string> &keys,
+ std::string name, const CSlice &slc_z, const CSlice &slc_y,
+ const CSlice &slc_x)
+{
+  EnzoEFltArrayMap out(name);
+  for (const std::string& key : keys){
+    out[key] = map.at(key).subarray(slc_z, slc_y, slc_x);
+  }
+  return out;
+}
+
+//----------------------------------------------------------------------
+
+// Returns a new map holding deep copies of the subarrays of all arrays in
+// map, stored in a single contiguous allocation
+static EnzoEFltArrayMap copy_subarrays_
+(const EnzoEFltArrayMap &map, std::string name, const CSlice &slc_z,
+ const CSlice &slc_y, const CSlice &slc_x)
+{
+  const EFlt3DArray first = map[0].subarray(slc_z, slc_y, slc_x);
+  const std::array<int,3> shape = {first.shape(0), first.shape(1),
+                                   first.shape(2)};
+  EnzoEFltArrayMap out(name, map.keys(), shape);
+  for (std::size_t i = 0; i < map.size(); i++){
+    out[i].subarray() = map[i].subarray(slc_z, slc_y, slc_x);
+  }
+  return out;
+}
+
+//----------------------------------------------------------------------
+
 EnzoEFltArrayMap EnzoMethodMHDVlct::nonpassive_primitive_map_(Block * block)
   const noexcept
 {
@@ -277,195 +318,404 @@ void EnzoMethodMHDVlct::compute ( Block * block) throw()
     // Check that the mesh size and ghost depths are appropriate
     check_mesh_and_ghost_size_(block);
 
-    // declaring Maps of arrays and stand-alone arrays that wrap existing
-    // fields and/or serve as scratch space.
-
-    // map that holds arrays wrapping the Cello Fields holding each of the
-    // primitive quantities. Additionally, this also includes temporary arrays
-    // used to hold the specific form of the passive scalar
-    EnzoEFltArrayMap primitive_map; // this will be overwritten
-
-    // map used for storing primitive values at the half time-step. This
-    // includes key,array pairs for each entry in primitive_map (there should
-    // be no aliased fields shared between maps)
-    EnzoEFltArrayMap temp_primitive_map("temp_primitive");
-
-    // map holding the arrays wrapping each fields corresponding to a passively
-    // advected scalar. The scalar is in conserved form.
-    EnzoEFltArrayMap conserved_passive_scalar_map; // this will be overwritten
-
-    // holds left and right reconstructed primitives (scratch-space)
-    EnzoEFltArrayMap priml_map("priml");
-    EnzoEFltArrayMap primr_map("primr");
-
-    // Arrays used to store the pressure computed from the reconstructed left
-    // and right primitives
-    // Note: in the case of adiabatic fluids, pressure is a reconstructable
-    //       quantity and entries are included for it in priml_map and
-    //       primr_map. In that case, pressure_l and pressure_r are aliases of
-    //       those arrays.
-    EFlt3DArray pressure_l, pressure_r;
-
-    // maps used to store fluxes (in the future, these will wrap FluxData
-    // entries)
-    EnzoEFltArrayMap xflux_map("xflux");
-    EnzoEFltArrayMap yflux_map("yflux");
-    EnzoEFltArrayMap zflux_map("zflux");
-
-    // map of arrays  used to accumulate the changes to the conserved forms of
-    // the integrable quantities and passively advected scalars. In other
-    // words, at the start of the (partial) timestep, the fields are all set to
-    // zero and are used to accumulate the flux divergence and source terms. If
-    // CT is used, it won't have space to store changes in the magnetic fields.
-    EnzoEFltArrayMap dUcons_map("dUcons");
-
-    setup_arrays_(block, primitive_map, temp_primitive_map,
-                  conserved_passive_scalar_map, priml_map, primr_map,
-		  pressure_l, pressure_r, xflux_map, yflux_map, zflux_map,
-                  dUcons_map);
-
-    // Setup a pointer to an array that used to store interface velocity fields
-    // from computed by the Riemann Solver (to use in the calculation of the
-    // internal energy source term). If the dual energy formalism is not in
-    // use, don't actually allocate the array and set the pointer to NULL.
-    EFlt3DArray interface_velocity_arr, *interface_velocity_arr_ptr;
-    if (eos_->uses_dual_energy_formalism()){
-      EFlt3DArray density = primitive_map.at("density");
-      interface_velocity_arr = EFlt3DArray(density.shape(0), density.shape(1),
-                                           density.shape(2));
-      interface_velocity_arr_ptr = &interface_velocity_arr;
+    // Reuse scratch space from the previous Block for temporary arrays
+    EnzoEFltArrayArena::instance()->reset();
+
+    if (interior_map_.find(block) != interior_map_.end()) {
+
+      // interior was already updated by compute_interior()
+      compute_boundary_(block);
+
     } else {
-      interface_velocity_arr_ptr = nullptr;
-    }
 
-    // allocate constrained transport object
-    if (bfield_method_ != nullptr) {
-      bfield_method_->register_target_block(block);
+      // integrate the fields in place
+      integrate_(block, nonpassive_primitive_map_(block),
+                 conserved_passive_scalar_map_(block));
+
     }
 
-    const enzo_float* const cell_widths = enzo::block(block)->CellWidth;
-
-    double dt = block->dt();
-
-    // stale_depth indicates the number of field entries from the outermost
-    // field value that the region including "stale" values (need to be
-    // refreshed) extends over.
-    int stale_depth = 0;
-
-    // convert the passive scalars from conserved form to specific form
-    // (outside the integrator, they are treated like conserved densities)
-    compute_specific_passive_scalars_(*(lazy_passive_list_.get_list()),
-                                      primitive_map["density"],
-                                      conserved_passive_scalar_map,
-                                      primitive_map, stale_depth);
-
-    // repeat the following loop twice (for half time-step and full time-step)
-
-    for (int i=0;i<2;i++){
-      double cur_dt = (i == 0) ? dt/2. : dt;
-      EnzoEFltArrayMap& cur_integrable_map =
-        (i == 0) ? primitive_map      : temp_primitive_map;
-      EnzoEFltArrayMap& out_integrable_map =
-        (i == 0) ? temp_primitive_map :      primitive_map;
-      // For the purposes of making the calculation procedure slightly more
-      // more explicit, we distinguish between cur_integrable_group and
-      // cur_reconstructable_group. Due to the high level of overlap between
-      // these, they are simply aliases of the same underlying Grouping that
-      // holds groups for both of them
-      EnzoEFltArrayMap& cur_reconstructable_map = cur_integrable_map;
-
-      EnzoReconstructor *reconstructor;
-
-      if (i == 0){
-        reconstructor = half_dt_recon_;
-      } else {
-        reconstructor = full_dt_recon_;
-
-        // After the fluxes were added to the passive scalar in the first half
-        // timestep, the values were stored in conserved form in the fields
-        // held by conserved_passive_scalar_map.
-        // Need to convert them to specific form
-        compute_specific_passive_scalars_(*(lazy_passive_list_.get_list()),
-                                          cur_integrable_map["density"],
-                                          conserved_passive_scalar_map,
-                                          cur_integrable_map, stale_depth);
+    EnzoEFltArrayArena::instance()->update_counters();
+  }
+
+  block->compute_done();
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodMHDVlct::compute_interior ( Block * block) throw()
+{
+  if (! (block->is_leaf() && can_split_(block))) return;
+
+  check_mesh_and_ghost_size_(block);
+
+  // Reuse scratch space from the previous Block for temporary arrays
+  EnzoEFltArrayArena::instance()->reset();
+
+  // the fields may still be read by neighbor Blocks' refreshes, so the
+  // integrator updates a copy of the active cells. Only values of cells
+  // further than the total staling depth from the ghost zones are
+  // correct; the others are recomputed by compute_boundary_() after the
+  // refresh
+
+  EnzoEFltArrayMap field_map = field_map_(block);
+
+  int gx,gy,gz;
+  block->data()->field().ghost_depth(0,&gx,&gy,&gz);
+  const EFlt3DArray& density = field_map.at("density");
+  const CSlice active_z(gz, density.shape(0) - gz);
+  const CSlice active_y(gy, density.shape(1) - gy);
+  const CSlice active_x(gx, density.shape(2) - gx);
+
+  EnzoEFltArrayMap interior_map = copy_subarrays_
+    (field_map, "interior", active_z, active_y, active_x);
+
+  const CSlice full(nullptr, nullptr);
+  integrate_(block,
+             select_subarrays_(interior_map, nonpassive_keys_(), "primitive",
+                               full, full, full),
+             select_subarrays_(interior_map, *(lazy_passive_list_.get_list()),
+                               "conserved_passive_scalar", full, full, full));
+
+  interior_map_[block] = interior_map;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodMHDVlct::compute_boundary_ (Block * block) noexcept
+{
+  EnzoEFltArrayMap interior_map = interior_map_[block];
+  interior_map_.erase(block);
+
+  EnzoEFltArrayMap field_map = field_map_(block);
+  const EFlt3DArray& density = field_map.at("density");
+
+  // ghost depth and array size along each axis (ordered z,y,x)
+  int gx,gy,gz;
+  block->data()->field().ghost_depth(0,&gx,&gy,&gz);
+  const int g3[3] = {gz, gy, gx};
+  const int m3[3] = {density.shape(0), density.shape(1), density.shape(2)};
+  const int depth = total_staling_depth_();
+
+  // The cells within depth of the ghost zones are the union of two slabs
+  // per axis. The slab along axis a covers the full active range along
+  // axes after a, and only the interior range along axes before a, so
+  // that each cell is updated once. Each slab is integrated in a copy of
+  // the refreshed fields padded by depth cells on all sides, and its
+  // updated cells replace the stale ones in interior_map, which holds
+  // only the active cells.
+
+  for (int a = 0; a < 3; a++) {
+    if (g3[a] == 0) continue;
+    for (int side = 0; side < 2; side++) {
+
+      int out_start[3], out_stop[3];
+      for (int b = 0; b < 3; b++) {
+        if (g3[b] == 0) {
+          out_start[b] = 0;
+          out_stop[b]  = m3[b];
+        } else if (b == a) {
+          out_start[b] = (side == 0) ? g3[b] : m3[b] - g3[b] - depth;
+          out_stop[b]  = out_start[b] + depth;
+        } else if (b < a) {
+          out_start[b] = g3[b] + depth;
+          out_stop[b]  = m3[b] - g3[b] - depth;
+        } else {
+          out_start[b] = g3[b];
+          out_stop[b]  = m3[b] - g3[b];
+        }
       }
 
-      // set all elements of the arrays in dUcons_map to 0 (throughout the rest
-      // of the current loop, flux divergence and source terms will be
-      // accumulated in these arrays)
-      integrable_updater_->clear_dUcons_map(dUcons_map, 0.,
-                                            *(lazy_passive_list_.get_list()));
-
-      // Compute the reconstructable quantities from the integrable quantites
-      // Although cur_integrable_map holds the passive scalars in integrable
-      // form, the conserved form of the values is required in case Grackle is
-      // being used.
-      //
-      // Note: cur_integrable_map and cur_reconstructable_map are aliases of
-      // the same map since there is such a large degree of overlap between
-      // reconstructable and integrable quantities
-      //
-      // For a barotropic gas, the following nominally does nothing
-      // For a non-barotropic gas, the following nominally computes pressure
-      eos_->reconstructable_from_integrable(cur_integrable_map,
-                                            cur_reconstructable_map,
-                                            conserved_passive_scalar_map,
-                                            stale_depth,
-                                            *(lazy_passive_list_.get_list()));
-
-      // Compute flux along each dimension
-      compute_flux_(0, cur_dt, cell_widths[0], cur_reconstructable_map,
-                    priml_map, primr_map, pressure_l, pressure_r,
-                    xflux_map, dUcons_map, interface_velocity_arr_ptr,
-                    *reconstructor, bfield_method_, stale_depth,
-                    *(lazy_passive_list_.get_list()));
-      compute_flux_(1, cur_dt, cell_widths[1], cur_reconstructable_map,
-                    priml_map, primr_map, pressure_l, pressure_r,
-                    yflux_map, dUcons_map, interface_velocity_arr_ptr,
-                    *reconstructor, bfield_method_, stale_depth,
-                    *(lazy_passive_list_.get_list()));
-      compute_flux_(2, cur_dt, cell_widths[2], cur_reconstructable_map,
-                    priml_map, primr_map, pressure_l, pressure_r,
-                    zflux_map, dUcons_map, interface_velocity_arr_ptr,
-                    *reconstructor, bfield_method_, stale_depth,
-                    *(lazy_passive_list_.get_list()));
-
-      // increment the stale_depth
-      stale_depth+=reconstructor->immediate_staling_rate();
-
-      // This is where source terms should be computed (added to dUcons_group)
-
-      // Update Bfields
-      if (bfield_method_ != nullptr) {
-        bfield_method_->update_all_bfield_components(cur_integrable_map,
-                                                     xflux_map, yflux_map,
-                                                     zflux_map,
-                                                     out_integrable_map, cur_dt,
-                                                     stale_depth);
-        bfield_method_->increment_partial_timestep();
+      CSlice win[3], out_win[3], out[3];
+      for (int b = 0; b < 3; b++) {
+        const int pad = (g3[b] == 0) ? 0 : depth;
+        win[b] = CSlice(out_start[b] - pad, out_stop[b] + pad);
+        out_win[b] = CSlice(pad, pad + out_stop[b] - out_start[b]);
+        out[b] = CSlice(out_start[b] - g3[b], out_stop[b] - g3[b]);
       }
 
-      // Update quantities (includes flux divergence and source terms) 
-      // This needs to happen after updating the cell-centered B-field so that
-      // the pressure floor can be applied to the total energy (and if
-      // necessary the total energy can be synchronized with internal energy)
-      //
-      // Note: updated passive scalars are NOT saved in out_integrable_group in
-      //     specific form. Instead they are saved in conserved_passive_scalars
-      //     in conserved form.
-      integrable_updater_->update_quantities
-        (primitive_map, dUcons_map, out_integrable_map,
-         conserved_passive_scalar_map, eos_, stale_depth,
-         *(lazy_passive_list_.get_list()));
-
-      // increment stale_depth since the inner values have been updated
-      // but the outer values have not
-      stale_depth+=reconstructor->delayed_staling_rate();
+      EnzoEFltArrayArena::instance()->reset();
+
+      EnzoEFltArrayMap slab_map = copy_subarrays_
+        (field_map, "slab", win[0], win[1], win[2]);
+
+      const CSlice full(nullptr, nullptr);
+      integrate_(block,
+                 select_subarrays_(slab_map, nonpassive_keys_(), "primitive",
+                                   full, full, full),
+                 select_subarrays_(slab_map, *(lazy_passive_list_.get_list()),
+                                   "conserved_passive_scalar",
+                                   full, full, full));
+
+      for (std::size_t i = 0; i < interior_map.size(); i++) {
+        const std::string& key = interior_map.key(i);
+        interior_map[i].subarray(out[0], out[1], out[2]) =
+          slab_map.at(key).subarray(out_win[0], out_win[1], out_win[2]);
+      }
     }
   }
 
-  block->compute_done();
+  // store the updated values of the active cells in the fields
+
+  const CSlice active_z(g3[0], m3[0] - g3[0]);
+  const CSlice active_y(g3[1], m3[1] - g3[1]);
+  const CSlice active_x(g3[2], m3[2] - g3[2]);
+
+  for (std::size_t i = 0; i < interior_map.size(); i++) {
+    const std::string& key = interior_map.key(i);
+    field_map.at(key).subarray(active_z, active_y, active_x) =
+      interior_map[i];
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodMHDVlct::integrate_
+(Block * block, EnzoEFltArrayMap nonpassive_map,
+ EnzoEFltArrayMap conserved_passive_scalar_map) noexcept
+{
+  // declaring Maps of arrays and stand-alone arrays that wrap existing
+  // fields and/or serve as scratch space.
+
+  // map that holds the arrays of each of the primitive quantities (the
+  // nonpassive arrays passed to this function). Additionally, this also
+  // includes temporary arrays used to hold the specific form of the passive
+  // scalar
+  EnzoEFltArrayMap primitive_map("primitive");
+  for (std::size_t i = 0; i < nonpassive_map.size(); i++){
+    primitive_map[nonpassive_map.key(i)] = nonpassive_map[i];
+  }
+
+  // map used for storing primitive values at the half time-step. This
+  // includes key,array pairs for each entry in primitive_map (there should
+  // be no aliased fields shared between maps)
+  EnzoEFltArrayMap temp_primitive_map("temp_primitive");
+
+  // holds left and right reconstructed primitives (scratch-space)
+  EnzoEFltArrayMap priml_map("priml");
+  EnzoEFltArrayMap primr_map("primr");
+
+  // Arrays used to store the pressure computed from the reconstructed left
+  // and right primitives
+  // Note: in the case of adiabatic fluids, pressure is a reconstructable
+  //       quantity and entries are included for it in priml_map and
+  //       primr_map. In that case, pressure_l and pressure_r are aliases of
+  //       those arrays.
+  EFlt3DArray pressure_l, pressure_r;
+
+  // maps used to store fluxes (in the future, these will wrap FluxData
+  // entries)
+  EnzoEFltArrayMap xflux_map("xflux");
+  EnzoEFltArrayMap yflux_map("yflux");
+  EnzoEFltArrayMap zflux_map("zflux");
+
+  // map of arrays  used to accumulate the changes to the conserved forms of
+  // the integrable quantities and passively advected scalars. In other
+  // words, at the start of the (partial) timestep, the fields are all set to
+  // zero and are used to accumulate the flux divergence and source terms. If
+  // CT is used, it won't have space to store changes in the magnetic fields.
+  EnzoEFltArrayMap dUcons_map("dUcons");
+
+  setup_arrays_(primitive_map, temp_primitive_map, priml_map, primr_map,
+                pressure_l, pressure_r, xflux_map, yflux_map, zflux_map,
+                dUcons_map);
+
+  // Setup a pointer to an array that used to store interface velocity fields
+  // from computed by the Riemann Solver (to use in the calculation of the
+  // internal energy source term). If the dual energy formalism is not in
+  // use, don't actually allocate the array and set the pointer to NULL.
+  EFlt3DArray interface_velocity_arr, *interface_velocity_arr_ptr;
+  if (eos_->uses_dual_energy_formalism()){
+    EFlt3DArray density = primitive_map.at("density");
+    interface_velocity_arr = EnzoEFltArrayArena::instance()->get
+      (density.shape(0), density.shape(1), density.shape(2));
+    interface_velocity_arr_ptr = &interface_velocity_arr;
+  } else {
+    interface_velocity_arr_ptr = nullptr;
+  }
+
+  // allocate constrained transport object
+  if (bfield_method_ != nullptr) {
+    bfield_method_->register_target_block(block);
+  }
+
+  const enzo_float* const cell_widths = enzo::block(block)->CellWidth;
+
+  double dt = block->dt();
+
+  // stale_depth indicates the number of field entries from the outermost
+  // field value that the region including "stale" values (need to be
+  // refreshed) extends over.
+  int stale_depth = 0;
+
+  // convert the passive scalars from conserved form to specific form
+  // (outside the integrator, they are treated like conserved densities)
+  compute_specific_passive_scalars_(*(lazy_passive_list_.get_list()),
+                                    primitive_map["density"],
+                                    conserved_passive_scalar_map,
+                                    primitive_map, stale_depth);
+
+  // repeat the following loop twice (for half time-step and full time-step)
+
+  for (int i=0;i<2;i++){
+    double cur_dt = (i == 0) ? dt/2. : dt;
+    EnzoEFltArrayMap& cur_integrable_map =
+      (i == 0) ? primitive_map      : temp_primitive_map;
+    EnzoEFltArrayMap& out_integrable_map =
+      (i == 0) ? temp_primitive_map :      primitive_map;
+    // For the purposes of making the calculation procedure slightly more
+    // more explicit, we distinguish between cur_integrable_group and
+    // cur_reconstructable_group. Due to the high level of overlap between
+    // these, they are simply aliases of the same underlying Grouping that
+    // holds groups for both of them
+    EnzoEFltArrayMap& cur_reconstructable_map = cur_integrable_map;
+
+    EnzoReconstructor *reconstructor;
+
+    if (i == 0){
+      reconstructor = half_dt_recon_;
+    } else {
+      reconstructor = full_dt_recon_;
+
+      // After the fluxes were added to the passive scalar in the first half
+      // timestep, the values were stored in conserved form in the fields
+      // held by conserved_passive_scalar_map.
+      // Need to convert them to specific form
+      compute_specific_passive_scalars_(*(lazy_passive_list_.get_list()),
+                                        cur_integrable_map["density"],
+                                        conserved_passive_scalar_map,
+                                        cur_integrable_map, stale_depth);
+    }
+
+    // set all elements of the arrays in dUcons_map to 0 (throughout the rest
+    // of the current loop, flux divergence and source terms will be
+    // accumulated in these arrays)
+    integrable_updater_->clear_dUcons_map(dUcons_map, 0.,
+                                          *(lazy_passive_list_.get_list()));
+
+    // Compute the reconstructable quantities from the integrable quantites
+    // Although cur_integrable_map holds the passive scalars in integrable
+    // form, the conserved form of the values is required in case Grackle is
+    // being used.
+    //
+    // Note: cur_integrable_map and cur_reconstructable_map are aliases of
+    // the same map since there is such a large degree of overlap between
+    // reconstructable and integrable quantities
+    //
+    // For a barotropic gas, the following nominally does nothing
+    // For a non-barotropic gas, the following nominally computes pressure
+    eos_->reconstructable_from_integrable(cur_integrable_map,
+                                          cur_reconstructable_map,
+                                          conserved_passive_scalar_map,
+                                          stale_depth,
+                                          *(lazy_passive_list_.get_list()));
+
+    // Compute flux along each dimension
+    compute_flux_(0, cur_dt, cell_widths[0], cur_reconstructable_map,
+                  priml_map, primr_map, pressure_l, pressure_r,
+                  xflux_map, dUcons_map, interface_velocity_arr_ptr,
+                  *reconstructor, bfield_method_, stale_depth,
+                  *(lazy_passive_list_.get_list()));
+    compute_flux_(1, cur_dt, cell_widths[1], cur_reconstructable_map,
+                  priml_map, primr_map, pressure_l, pressure_r,
+                  yflux_map, dUcons_map, interface_velocity_arr_ptr,
+                  *reconstructor, bfield_method_, stale_depth,
+                  *(lazy_passive_list_.get_list()));
+    compute_flux_(2, cur_dt, cell_widths[2], cur_reconstructable_map,
+                  priml_map, primr_map, pressure_l, pressure_r,
+                  zflux_map, dUcons_map, interface_velocity_arr_ptr,
+                  *reconstructor, bfield_method_, stale_depth,
+                  *(lazy_passive_list_.get_list()));
+
+    // increment the stale_depth
+    stale_depth+=reconstructor->immediate_staling_rate();
+
+    // This is where source terms should be computed (added to dUcons_group)
+
+    // Update Bfields
+    if (bfield_method_ != nullptr) {
+      bfield_method_->update_all_bfield_components(cur_integrable_map,
+                                                   xflux_map, yflux_map,
+                                                   zflux_map,
+                                                   out_integrable_map, cur_dt,
+                                                   stale_depth);
+      bfield_method_->increment_partial_timestep();
+    }
+
+    // Update quantities (includes flux divergence and source terms) 
+    // This needs to happen after updating the cell-centered B-field so that
+    // the pressure floor can be applied to the total energy (and if
+    // necessary the total energy can be synchronized with internal energy)
+    //
+    // Note: updated passive scalars are NOT saved in out_integrable_group in
+    //     specific form. Instead they are saved in conserved_passive_scalars
+    //     in conserved form.
+    integrable_updater_->update_quantities
+      (primitive_map, dUcons_map, out_integrable_map,
+       conserved_passive_scalar_map, eos_, stale_depth,
+       *(lazy_passive_list_.get_list()));
+
+    // increment stale_depth since the inner values have been updated
+    // but the outer values have not
+    stale_depth+=reconstructor->delayed_staling_rate();
+  }
+}
+
+//----------------------------------------------------------------------
+
+int EnzoMethodMHDVlct::total_staling_depth_ () const noexcept
+{
+  return (half_dt_recon_->total_staling_rate() +
+          full_dt_recon_->total_staling_rate());
+}
+
+//----------------------------------------------------------------------
+
+bool EnzoMethodMHDVlct::can_split_ (Block * block) const noexcept
+{
+  // constrained transport updates face-centered fields tracked by
+  // bfield_method_ for the whole block, so it can't be split
+
+  if (bfield_method_ != nullptr) return false;
+
+  // the interior must be non-empty, and boundary slabs must fit within
+  // the ghost zones
+
+  Field field = block->data()->field();
+  int nx,ny,nz;
+  field.size(&nx,&ny,&nz);
+  int gx,gy,gz;
+  field.ghost_depth(0,&gx,&gy,&gz);
+  const int depth = total_staling_depth_();
+  const int n3[3] = {nx, ny, nz};
+  const int g3[3] = {gx, gy, gz};
+  for (int i = 0; i < 3; i++) {
+    if (g3[i] > 0 && (g3[i] < depth || n3[i] <= 2*depth)) return false;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------
+
+std::vector<std::string> EnzoMethodMHDVlct::nonpassive_keys_ () const noexcept
+{
+  return unique_combination_(integrable_field_list_,
+                             reconstructable_field_list_);
+}
+
+//----------------------------------------------------------------------
+
+EnzoEFltArrayMap EnzoMethodMHDVlct::field_map_ (Block * block) const noexcept
+{
+  EnzoEFltArrayMap map("fields");
+  EnzoEFltArrayMap nonpassive = nonpassive_primitive_map_(block);
+  EnzoEFltArrayMap passive = conserved_passive_scalar_map_(block);
+  for (std::size_t i = 0; i < nonpassive.size(); i++){
+    map[nonpassive.key(i)] = nonpassive[i];
+  }
+  for (std::size_t i = 0; i < passive.size(); i++){
+    map[passive.key(i)] = passive[i];
+  }
+  return map;
 }
 
 //----------------------------------------------------------------------
@@ -529,6 +779,14 @@ void EnzoMethodMHDVlct::compute_flux_
  EnzoBfieldMethod *bfield_method, int stale_depth,
  const str_vec_t& passive_list) const noexcept
 {
+  if (tile_depth_ > 0) {
+    compute_flux_tiled_(dim, cur_dt, cell_width, reconstructable_map,
+                        priml_map, primr_map, pressure_l, pressure_r,
+                        flux_map, dUcons_map, interface_velocity_arr_ptr,
+                        reconstructor, bfield_method, stale_depth,
+                        passive_list);
+    return;
+  }
 
   // purely for the purposes of making the caluclation more explicit, we define
   // the following aliases for priml_map and primr_map
@@ -595,31 +853,127 @@ void EnzoMethodMHDVlct::compute_flux_
 
 //----------------------------------------------------------------------
 
+void EnzoMethodMHDVlct::compute_flux_tiled_
+(int dim, double cur_dt, enzo_float cell_width,
+ EnzoEFltArrayMap &reconstructable_map,
+ EnzoEFltArrayMap &priml_map, EnzoEFltArrayMap &primr_map,
+ EFlt3DArray &pressure_l, EFlt3DArray &pressure_r,
+ EnzoEFltArrayMap &flux_map, EnzoEFltArrayMap &dUcons_map,
+ EFlt3DArray *interface_velocity_arr_ptr, EnzoReconstructor &reconstructor,
+ EnzoBfieldMethod *bfield_method, int stale_depth,
+ const str_vec_t& passive_list) const noexcept
+{
+  // stale depth of all stages after reconstruction
+  const int cur_stale_depth = stale_depth +
+    reconstructor.immediate_staling_rate();
+
+  // slabs are stacked along the outermost axis that differs from dim
+  const int axis = (dim == 0) ? 1 : 0;
+  const int m = reconstructable_map.at("density").shape(axis);
+
+  CSlice full_ax(nullptr, nullptr);
+
+  // each slab updates the cells [start, stop) along axis. Since every stage
+  // ignores the outermost cur_stale_depth cells along all axes, the arrays
+  // passed to each stage are padded by cur_stale_depth on both sides. The
+  // padding cells of reconstructed values are recomputed by neighboring
+  // slabs, but since reconstruction does not have a stencil along axis they
+  // are overwritten with identical values.
+  for (int start = cur_stale_depth; start < m - cur_stale_depth;
+       start += tile_depth_) {
+    const int stop = std::min(start + tile_depth_, m - cur_stale_depth);
+    const CSlice tile(start - cur_stale_depth, stop + cur_stale_depth);
+    const CSlice slc_z = (axis == 0) ? tile : full_ax;
+    const CSlice slc_y = (axis == 1) ? tile : full_ax;
+
+    EnzoEFltArrayMap tile_prim = reconstructable_map.subarray_map
+      (slc_z, slc_y, full_ax);
+    EnzoEFltArrayMap tile_l = priml_map.subarray_map(slc_z, slc_y, full_ax);
+    EnzoEFltArrayMap tile_r = primr_map.subarray_map(slc_z, slc_y, full_ax);
+    EnzoEFltArrayMap tile_flux = flux_map.subarray_map(slc_z, slc_y, full_ax);
+    EnzoEFltArrayMap tile_dUcons = dUcons_map.subarray_map
+      (slc_z, slc_y, full_ax);
+    EFlt3DArray tile_pressure_l = pressure_l.subarray(slc_z, slc_y, full_ax);
+    EFlt3DArray tile_pressure_r = pressure_r.subarray(slc_z, slc_y, full_ax);
+    EFlt3DArray tile_interface_velocity, *tile_interface_velocity_ptr;
+    if (interface_velocity_arr_ptr != nullptr) {
+      tile_interface_velocity = interface_velocity_arr_ptr->subarray
+        (slc_z, slc_y, full_ax);
+      tile_interface_velocity_ptr = &tile_interface_velocity;
+    } else {
+      tile_interface_velocity_ptr = nullptr;
+    }
+
+    reconstructor.reconstruct_interface(tile_prim, tile_l, tile_r,
+                                        dim, eos_, stale_depth, passive_list);
+
+    if (bfield_method != nullptr) {
+      std::array<int,3> offset = {{0,0,0}};
+      offset[axis] = start - cur_stale_depth;
+      bfield_method->correct_reconstructed_bfield(tile_l, tile_r, dim,
+                                                  cur_stale_depth, offset);
+    }
+
+    // tile_l and tile_r hold both the reconstructable and integrable values
+    eos_->integrable_from_reconstructable(tile_l, tile_l,
+                                          cur_stale_depth, passive_list);
+    eos_->integrable_from_reconstructable(tile_r, tile_r,
+                                          cur_stale_depth, passive_list);
+
+    eos_->pressure_from_reconstructable(tile_l, tile_pressure_l,
+                                        cur_stale_depth);
+    eos_->pressure_from_reconstructable(tile_r, tile_pressure_r,
+                                        cur_stale_depth);
+
+    riemann_solver_->solve(tile_l, tile_r, tile_pressure_l, tile_pressure_r,
+                           tile_flux, dim, eos_, cur_stale_depth,
+                           passive_list, tile_interface_velocity_ptr);
+
+    integrable_updater_->accumulate_flux_component(dim, cur_dt, cell_width,
+                                                   tile_flux, tile_dUcons,
+                                                   cur_stale_depth,
+                                                   passive_list);
+
+    if (eos_->uses_dual_energy_formalism()){
+      EnzoSourceInternalEnergy eint_src;
+      eint_src.calculate_source(dim, cur_dt, cell_width, tile_prim,
+                                tile_dUcons, *tile_interface_velocity_ptr,
+                                eos_, cur_stale_depth);
+    }
+  }
+
+  // record the upwind direction over the whole block (for handling CT)
+  if (bfield_method != nullptr){
+    bfield_method->identify_upwind(flux_map, dim, cur_stale_depth);
+  }
+}
+
+//----------------------------------------------------------------------
+
 static void add_temporary_arrays_to_map_
 (EnzoEFltArrayMap &map, std::array<int,3> &shape,
  const std::vector<std::string>* const nonpassive_names,
  const str_vec_t* const passive_lists)
 {
-
+  // temporary arrays are drawn from the per-process scratch arena, so that
+  // their storage is reused from one Block to the next. All of the arrays
+  // are slices of one contiguous 4D array.
+  std::vector<std::string> keys;
   if (nonpassive_names != nullptr){
-    for (const std::string& name : (*nonpassive_names)){
-      map[name] = EFlt3DArray(shape[0], shape[1], shape[2]);
-    }
+    keys.insert(keys.end(), nonpassive_names->begin(),
+                nonpassive_names->end());
   }
-
   if (passive_lists != nullptr){
-    for (const std::string& key : (*passive_lists)){
-      map[key] = EFlt3DArray(shape[0], shape[1], shape[2]);
-    }
+    keys.insert(keys.end(), passive_lists->begin(), passive_lists->end());
   }
+  EnzoEFltArrayArena::instance()->add_to_map(map, shape, keys);
 }
 
 //----------------------------------------------------------------------
 
 void EnzoMethodMHDVlct::setup_arrays_
-(Block *block, EnzoEFltArrayMap &primitive_map,
+(EnzoEFltArrayMap &primitive_map,
  EnzoEFltArrayMap &temp_primitive_map,
- EnzoEFltArrayMap &conserved_passive_scalar_map,
  EnzoEFltArrayMap &priml_map, EnzoEFltArrayMap &primr_map,
  EFlt3DArray &pressure_l, EFlt3DArray &pressure_r,
  EnzoEFltArrayMap &xflux_map, EnzoEFltArrayMap &yflux_map,
@@ -636,11 +990,8 @@ void EnzoMethodMHDVlct::setup_arrays_
   std::vector<std::string> combined_key_list = unique_combination_
     (integrable_field_list_, reconstructable_field_list_);
 
-  // First, setup conserved_passive_scalar_map
-  conserved_passive_scalar_map = conserved_passive_scalar_map_(block);
-
-  // Next, setup nonpassive components of primitive_map
-  primitive_map = nonpassive_primitive_map_(block);
+  // primitive_map already holds the nonpassive primitives. Add temporary
+  // arrays for the specific form of the passive scalars
   std::array<int,3> shape = {primitive_map.at("density").shape(0),
                              primitive_map.at("density").shape(1),
                              primitive_map.at("density").shape(2)};
@@ -687,8 +1038,9 @@ void EnzoMethodMHDVlct::setup_arrays_
     pressure_l = priml_map.at("pressure");
     pressure_r = primr_map.at("pressure");
   } else {
-    pressure_l = EFlt3DArray(shape[0], shape[1], shape[2]);
-    pressure_r = EFlt3DArray(shape[0], shape[1], shape[2]);
+    EnzoEFltArrayArena * arena = EnzoEFltArrayArena::instance();
+    pressure_l = arena->get(shape[0], shape[1], shape[2]);
+    pressure_r = arena->get(shape[0], shape[1], shape[2]);
   }
 
 }
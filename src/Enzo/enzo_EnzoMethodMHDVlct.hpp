@@ -106,7 +106,8 @@ public: // interface
 		    double pressure_floor,
 		    std::string mhd_choice,
 		    bool dual_energy_formalism,
-		    double dual_energy_formalism_eta);
+		    double dual_energy_formalism_eta,
+		    int tile_depth = 0);
 
   /// Charm++ PUP::able declarations
   PUPable_decl(EnzoMethodMHDVlct);
@@ -123,7 +124,9 @@ public: // interface
       bfield_method_(nullptr),
       integrable_field_list_(),
       reconstructable_field_list_(),
-      lazy_passive_list_()
+      lazy_passive_list_(),
+      tile_depth_(0),
+      interior_map_()
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -135,6 +138,11 @@ public: // interface
   /// Apply the method to advance a block one timestep 
   virtual void compute( Block * block) throw();
 
+  /// Integrate a copy of the active cells while the Method's refresh is in
+  /// progress (Method:mhd_vlct:overlap_refresh), keeping the values of
+  /// cells that don't depend on ghost zones until compute() is called
+  virtual void compute_interior( Block * block) throw();
+
   virtual std::string name () throw () 
   { return "mhd_vlct"; }
 
@@ -268,14 +276,33 @@ protected: // methods
    EnzoBfieldMethod *bfield_method, int stale_depth,
    const str_vec_t& passive_list) const noexcept;
 
-  /// Setup arrays used throughout `compute`. This includes both arrays that
-  /// wrap Cello fields AND temporary arrays used as scratch space.
+  /// Fused alternative to the body of `compute_flux_` used when
+  /// `tile_depth_ > 0`. It accepts the same arguments.
+  ///
+  /// Rather than sweeping each stage (reconstruction, Riemann solver, flux
+  /// accumulation) over the whole block in turn, the block is divided into
+  /// slabs of `tile_depth_` cells along an axis orthogonal to `dim`, and all
+  /// stages are applied to one slab before moving on to the next, so that
+  /// the intermediate values are still in cache when they are reused.
+  /// Since none of the stages have stencils extending along the slab axis,
+  /// each slab is padded by the current stale depth along that axis, and
+  /// the results are identical to those of the unfused path.
+  void compute_flux_tiled_
+  (int dim, double cur_dt, enzo_float cell_width,
+   EnzoEFltArrayMap &reconstructable_map,
+   EnzoEFltArrayMap &priml_map, EnzoEFltArrayMap &primr_map,
+   EFlt3DArray &pressure_l, EFlt3DArray &pressure_r,
+   EnzoEFltArrayMap &flux_map, EnzoEFltArrayMap &dUcons_map,
+   EFlt3DArray *interface_velocity_arr_ptr, EnzoReconstructor &reconstructor,
+   EnzoBfieldMethod *bfield_method, int stale_depth,
+   const str_vec_t& passive_list) const noexcept;
+
+  /// Setup temporary arrays used as scratch space throughout `integrate_`.
   ///
-  /// @param[in]  block holds data to be processed
-  /// @param[out] primitive_map Map of arrays wrapping the Cello Fields holding
-  ///     each of the integrable and reconstructable quantity. This also holds
-  ///     temporary arrays where the specific form of the passively advected
-  ///     scalars will be stored.
+  /// @param[in,out] primitive_map Map of arrays holding each of the
+  ///     integrable and reconstructable quantities. Temporary arrays where
+  ///     the specific form of the passively advected scalars will be stored
+  ///     are added to it.
   /// @param[out] temp_primitive_map Map for storing the integrable and
   ///     reconstructable quantities at the half timestep. This should have all
   ///     the same entries as primitive_map. However, all arrays in this map
@@ -301,14 +328,46 @@ protected: // methods
   ///     space to store changes in the magnetic fields (that update is handled
   ///     separately).
   void setup_arrays_
-  (Block *block, EnzoEFltArrayMap &primitive_map,
+  (EnzoEFltArrayMap &primitive_map,
    EnzoEFltArrayMap &temp_primitive_map,
-   EnzoEFltArrayMap &conserved_passive_scalar_map,
    EnzoEFltArrayMap &priml_map, EnzoEFltArrayMap &primr_map,
    EFlt3DArray &pressure_l, EFlt3DArray &pressure_r,
    EnzoEFltArrayMap &xflux_map, EnzoEFltArrayMap &yflux_map,
    EnzoEFltArrayMap &zflux_map, EnzoEFltArrayMap &dUcons_map) noexcept;
 
+  /// Advance the integrable quantities held in the given maps by one
+  /// timestep, in place. The arrays may be the fields of block, or copies
+  /// of (subarrays of) them.
+  ///
+  /// @param[in]     block the Block being updated (provides the timestep,
+  ///     cell widths and, if used, the target of bfield_method_)
+  /// @param[in,out] nonpassive_map Map holding the arrays of the nonpassive
+  ///     primitive quantities
+  /// @param[in,out] conserved_passive_scalar_map Map holding the arrays of
+  ///     passively advected scalars (in conserved form)
+  void integrate_(Block * block, EnzoEFltArrayMap nonpassive_map,
+                  EnzoEFltArrayMap conserved_passive_scalar_map) noexcept;
+
+  /// Update the cells within the total staling depth of the ghost zones,
+  /// after the interior was updated by compute_interior(), and store the
+  /// results in the fields
+  void compute_boundary_(Block * block) noexcept;
+
+  /// Number of cells from the edge of the arrays that are stale after a
+  /// full timestep
+  int total_staling_depth_() const noexcept;
+
+  /// Whether the update of block can be split into interior and boundary
+  /// parts
+  bool can_split_(Block * block) const noexcept;
+
+  /// Keys of the nonpassive primitive quantities
+  std::vector<std::string> nonpassive_keys_() const noexcept;
+
+  /// Constructs a map containing the field data of the nonpassive
+  /// primitives followed by the passive scalars (in conserved form)
+  EnzoEFltArrayMap field_map_(Block * block) const noexcept;
+
 protected: // attributes
 
   /// Pointer to the equation of state of the fluid
@@ -340,6 +399,15 @@ protected: // attributes
 
   /// Lazy initializer of the list of fields holding passive scalars
   EnzoLazyPassiveScalarFieldList lazy_passive_list_;
+
+  /// Number of cells per slab when fusing the flux computation stages (0 to
+  /// sweep each stage over the whole block)
+  int tile_depth_;
+
+  /// Updated values of the fields computed by compute_interior() for each
+  /// Block on this process, until compute() is called (not checkpointed,
+  /// since it is empty between Method applications)
+  std::map<Block *, EnzoEFltArrayMap> interior_map_;
 };
 
 #endif /* ENZO_ENZO_METHOD_VLCT_HPP */
@@ -48,6 +48,10 @@ EnzoMethodPmDeposit::EnzoMethodPmDeposit ( double alpha)
 
   this->define_fields();
 
+  // compute() only writes the particle and total density fields
+  this->set_modified_fields
+    ({"density_total","density_particle","density_particle_accumulate"});
+
   // Initialize default Refresh object
 
   cello::simulation()->new_refresh_set_name(ir_post_,name());
@@ -35,6 +35,9 @@ EnzoMethodPmUpdate::EnzoMethodPmUpdate
 
   this->define_fields();
 
+  // compute() only updates particle positions and velocities
+  this->set_modified_fields({});
+
   // Initialize default Refresh object
 
   cello::simulation()->new_refresh_set_name(ir_post_,name());
@@ -68,6 +68,9 @@ EnzoMethodPpm::EnzoMethodPpm ()
   // add all color fields to refresh
   refresh->add_all_fields("color");
 
+  // Report solver workspace statistics in the Performance counters
+  EnzoHydroWorkspace::instance()->new_counters();
+
    // PPM parameters initialized in EnzoBlock::initialize()
 }
 
@@ -164,6 +167,10 @@ void EnzoMethodPpm::compute ( Block * block) throw()
 
     TRACE_PPM ("END SolveHydroEquations");
 
+    // SolveHydroEquations() reuses scratch space from the previous
+    // Block on this process
+    EnzoHydroWorkspace::instance()->update_counters();
+
   }
 
 #ifdef COPY_FIELDS_TO_OUTPUT
@@ -399,7 +399,8 @@ Solver * EnzoProblem::create_solver_
        enzo_config->solver_iter_max[index_solver],
        enzo_config->solver_res_tol[index_solver],
        enzo_config->solver_precondition[index_solver],
-       enzo_config->solver_coarse_level[index_solver]);
+       enzo_config->solver_coarse_level[index_solver],
+       enzo_config->solver_merge_reductions[index_solver]);
 
   } else if (solver_type == "diagonal") {
 
@@ -421,7 +422,8 @@ Solver * EnzoProblem::create_solver_
        enzo_config->solver_restart_cycle[index_solver],
        solve_type,
        enzo_config->solver_weight[index_solver],
-       enzo_config->solver_iter_max[index_solver]);
+       enzo_config->solver_iter_max[index_solver],
+       enzo_config->solver_sweeps_per_refresh[index_solver]);
 
   } else if (solver_type == "mg0") {
 
@@ -571,7 +573,8 @@ Method * EnzoProblem::create_method_
 
     method = new EnzoMethodHeat
       (enzo_config->method_heat_alpha,
-       config->method_courant[index_method]);
+       config->method_courant[index_method],
+       config->method_overlap_refresh[index_method]);
 
 #ifdef CONFIG_USE_GRACKLE
     //--------------------------------------------------
@@ -637,7 +640,8 @@ Method * EnzoProblem::create_method_
        enzo_config->method_vlct_pressure_floor,
        enzo_config->method_vlct_mhd_choice,
        enzo_config->method_vlct_dual_energy,
-       enzo_config->method_vlct_dual_energy_eta);
+       enzo_config->method_vlct_dual_energy_eta,
+       enzo_config->method_vlct_tile_depth);
 
   } else if (name == "background_acceleration") {
 
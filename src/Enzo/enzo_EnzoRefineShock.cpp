@@ -131,11 +131,12 @@ void EnzoRefineShock::evaluate_block_
   enzo_float er_max = -std::numeric_limits<enzo_float>::max();
 #endif
   
-  for (int axis=0; axis<rank; axis++) {
+  // visit each cell once, evaluating all axes there
 
-    for (int iz=gz; iz<nz+gz; iz++) {
-      for (int iy=gy; iy<ny+gy; iy++) {
-	for (int ix=gx; ix<nx+gx; ix++) {
+  for (int iz=gz; iz<nz+gz; iz++) {
+    for (int iy=gy; iy<ny+gy; iy++) {
+      for (int ix=gx; ix<nx+gx; ix++) {
+	for (int axis=0; axis<rank; axis++) {
 
 	  int i = ix + ndx*(iy + ndy*iz);
 	  int id = d3[axis];
@@ -171,11 +172,13 @@ void EnzoRefineShock::evaluate_block_
 	  if (l_same)    *all_coarsen = false;
 
 	  if (output) {
-	    if (l_same)   output[i] =  0;
+	    if (l_same)   output[i] =  std::max(output[i],enzo_float(0));
 	    if (l_refine) output[i] = +1;
 	  }
 	}
       }
+      // refinement is certain: remaining cells only matter for output
+      if (*any_refine && ! output) return;
     }
   }
 #ifdef DEBUG_ENZO_REFINE_SHOCK
@@ -9,6 +9,16 @@
 #ifndef ENZO_ENZO_RIEMANN_HPP
 #define ENZO_ENZO_RIEMANN_HPP
 
+/// Default number of cell interfaces along the x-axis (the contiguous
+/// axis) that `EnzoRiemannImpl::solve` processes as a batch of lanes (see
+/// EnzoRiemann::set_lanes). The default of 1 selects the scalar path (one
+/// interface at a time): the batched path still calls the scalar solver
+/// once per lane, so it only helps where the compiler vectorizes that
+/// loop. test_EnzoRiemann reports the throughput of each setting.
+#ifndef ENZO_RIEMANN_LANES
+#  define ENZO_RIEMANN_LANES 1
+#endif
+
 
 
 class EnzoRiemann : public PUP::able
@@ -31,6 +41,7 @@ public: // interface
     (std::vector<std::string> integrable_quantities, std::string solver);
 
   EnzoRiemann() throw()
+    : lanes_(ENZO_RIEMANN_LANES)
   {}
 
   /// Virtual destructor
@@ -42,15 +53,26 @@ public: // interface
 
   /// CHARM++ migration constructor for PUP::able
   EnzoRiemann (CkMigrateMessage *m)
-    : PUP::able(m)
+    : PUP::able(m),
+      lanes_(ENZO_RIEMANN_LANES)
   {  }
 
   /// CHARM++ Pack / Unpack function
   void pup (PUP::er &p)
   {
     PUP::able::pup(p);
+    p | lanes_;
   }
 
+  /// Set the number of interfaces solved as a batch of lanes: 4 or 8
+  /// select the batched path, and any other value the scalar path
+  void set_lanes (int lanes) throw()
+  { lanes_ = lanes; }
+
+  /// Return the number of interfaces solved as a batch of lanes
+  int lanes () const throw()
+  { return lanes_; }
+
   /// Computes the Riemann Fluxes for each conserved field along a given
   /// dimension, dim
   /// @param[in]     priml_map,primr_map Maps of arrays holding the left/right
@@ -89,6 +111,11 @@ public: // interface
    int stale_depth, const str_vec_t &passive_list,
    EFlt3DArray *interface_velocity) const = 0;
 
+protected: // attributes
+
+  /// Number of interfaces solved as a batch of lanes
+  int lanes_;
+
 };
 
 #endif /* ENZO_ENZO_RIEMANN_HPP */
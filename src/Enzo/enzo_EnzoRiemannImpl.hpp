@@ -11,6 +11,7 @@
 
 #include <pup_stl.h>
 #include <cstdint> // used to check that static methods are defined
+#include <algorithm> // std::min
 
 //----------------------------------------------------------------------
 
@@ -192,6 +193,21 @@ public: // interface
               EFlt3DArray *interface_velocity) const;
 
 protected : //methods
+
+  /// Computes the fluxes at interfaces ix_start <= ix < ix_stop of row
+  /// (iz,iy) in batches of W lanes. The primitives of a batch are
+  /// gathered into structure-of-arrays buffers, solve_interface is
+  /// called for each lane in a loop the compiler is asked to vectorize,
+  /// and the fluxes are scattered back
+  template <int W, class F>
+  void solve_batches_
+  (const F &solve_interface,
+   const std::array<EFlt3DArray,LUT::NEQ> &wl_arrays,
+   const std::array<EFlt3DArray,LUT::NEQ> &wr_arrays,
+   const EFlt3DArray &pressure_array_l, const EFlt3DArray &pressure_array_r,
+   std::array<EFlt3DArray,LUT::NEQ> &flux_arrays,
+   EFlt3DArray *velocity_i_bar_array,
+   int iz, int iy, int ix_start, int ix_stop) const;
   
   /// Computes the fluxes for the passively advected quantites.
   void solve_passive_advection_(EnzoEFltArrayMap &prim_map_l,
@@ -330,11 +346,53 @@ void EnzoRiemannImpl<ImplFunctor>::solve
 
   ImplFunctor func;
 
+  // computes the flux at a single interface from the left/right primitives
+  // and pressures
+  auto solve_interface = [&func, barotropic, gamma, isothermal_cs]
+    (const lutarray<LUT> &wl, const lutarray<LUT> &wr,
+     enzo_float pressure_l, enzo_float pressure_r,
+     enzo_float &interface_velocity_i) -> lutarray<LUT>
+    {
+      // get the conserved quantities
+      lutarray<LUT> Ul = enzo_riemann_utils::compute_conserved<LUT>(wl);
+      lutarray<LUT> Ur = enzo_riemann_utils::compute_conserved<LUT>(wr);
+
+      // compute the interface fluxes
+      lutarray<LUT> Fl = enzo_riemann_utils::active_fluxes<LUT>(wl, Ul,
+                                                                pressure_l);
+      lutarray<LUT> Fr = enzo_riemann_utils::active_fluxes<LUT>(wr, Ur,
+                                                                pressure_r);
+
+      // Now compute the Riemann Fluxes
+      return func(Fl, Fr, wl, wr, Ul, Ur, pressure_l, pressure_r, barotropic,
+                  gamma, isothermal_cs, interface_velocity_i);
+    };
+
   // compute the flux at all non-stale cell interfaces
   const int sd = stale_depth;
+  const int ix_start = sd;
+  const int ix_stop = flux_arrays[0].shape(2) - sd;
+  EFlt3DArray *vi_array = store_interface_vel ? &velocity_i_bar_array
+                                              : nullptr;
+
   for (int iz = sd; iz < flux_arrays[0].shape(0) - sd; iz++) {
     for (int iy = sd; iy < flux_arrays[0].shape(1) - sd; iy++) {
-      for (int ix = sd; ix < flux_arrays[0].shape(2) - sd; ix++) {
+
+      if (lanes_ == 8) {
+        solve_batches_<8>(solve_interface, wl_arrays, wr_arrays,
+                          pressure_array_l, pressure_array_r, flux_arrays,
+                          vi_array, iz, iy, ix_start, ix_stop);
+        continue;
+      } else if (lanes_ == 4) {
+        solve_batches_<4>(solve_interface, wl_arrays, wr_arrays,
+                          pressure_array_l, pressure_array_r, flux_arrays,
+                          vi_array, iz, iy, ix_start, ix_stop);
+        continue;
+      }
+
+      // scalar path
+
+      for (int ix = ix_start; ix < ix_stop; ix++) {
 
 	lutarray<LUT> wl, wr;
 	// get the fluid fields
@@ -347,21 +405,9 @@ void EnzoRiemannImpl<ImplFunctor>::solve
 	enzo_float pressure_l = pressure_array_l(iz,iy,ix);
 	enzo_float pressure_r = pressure_array_r(iz,iy,ix);
 
-	// get the conserved quantities
-	lutarray<LUT> Ul = enzo_riemann_utils::compute_conserved<LUT>(wl);
-	lutarray<LUT> Ur = enzo_riemann_utils::compute_conserved<LUT>(wr);
-
-	// compute the interface fluxes
-	lutarray<LUT> Fl = enzo_riemann_utils::active_fluxes<LUT>(wl, Ul,
-                                                                  pressure_l);
-	lutarray<LUT> Fr = enzo_riemann_utils::active_fluxes<LUT>(wr, Ur,
-                                                                  pressure_r);
-
 	enzo_float interface_velocity_i;
-	// Now compute the Riemann Fluxes
-        lutarray<LUT> fluxes = func(Fl, Fr, wl, wr, Ul, Ur, pressure_l,
-                                    pressure_r, barotropic, gamma,
-                                    isothermal_cs, interface_velocity_i);
+	lutarray<LUT> fluxes = solve_interface(wl, wr, pressure_l, pressure_r,
+                                               interface_velocity_i);
 
 	// record the Riemann Fluxes
 	for (std::size_t field_ind=0; field_ind<LUT::NEQ; field_ind++){
@@ -372,6 +418,7 @@ void EnzoRiemannImpl<ImplFunctor>::solve
 	  velocity_i_bar_array(iz,iy,ix) = interface_velocity_i;
 	}
       }
+
     }
   }
 
@@ -429,6 +476,76 @@ inline void passive_advection_helper_
   delete[] wl_arrays; delete[] wr_arrays; delete[] flux_arrays;
 }
 
+template <class ImplFunctor>
+template <int W, class F>
+void EnzoRiemannImpl<ImplFunctor>::solve_batches_
+(const F &solve_interface,
+ const std::array<EFlt3DArray,LUT::NEQ> &wl_arrays,
+ const std::array<EFlt3DArray,LUT::NEQ> &wr_arrays,
+ const EFlt3DArray &pressure_array_l, const EFlt3DArray &pressure_array_r,
+ std::array<EFlt3DArray,LUT::NEQ> &flux_arrays,
+ EFlt3DArray *velocity_i_bar_array,
+ int iz, int iy, int ix_start, int ix_stop) const
+{
+  for (int ix0 = ix_start; ix0 < ix_stop; ix0 += W) {
+    // number of valid lanes in this batch
+    const int nl = std::min(W, ix_stop - ix0);
+
+    // gather left/right primitives and pressures into lanes. Unused
+    // lanes of the last batch repeat the last valid interface so that
+    // every lane holds a physical state
+    enzo_float wl_lanes[LUT::NEQ][W], wr_lanes[LUT::NEQ][W];
+    enzo_float pl_lanes[W], pr_lanes[W];
+    enzo_float flux_lanes[LUT::NEQ][W], vi_lanes[W];
+
+    for (std::size_t field_ind=0; field_ind<LUT::NEQ; field_ind++){
+      const EFlt3DArray &wl_arr = wl_arrays[field_ind];
+      const EFlt3DArray &wr_arr = wr_arrays[field_ind];
+      for (int l = 0; l < W; l++){
+        const int ix = ix0 + std::min(l, nl - 1);
+        wl_lanes[field_ind][l] = wl_arr(iz,iy,ix);
+        wr_lanes[field_ind][l] = wr_arr(iz,iy,ix);
+      }
+    }
+    for (int l = 0; l < W; l++){
+      const int ix = ix0 + std::min(l, nl - 1);
+      pl_lanes[l] = pressure_array_l(iz,iy,ix);
+      pr_lanes[l] = pressure_array_r(iz,iy,ix);
+    }
+
+    // solve the Riemann problem for every lane
+    ENZO_SIMD_LOOP
+    for (int l = 0; l < W; l++){
+      lutarray<LUT> wl, wr;
+      for (std::size_t field_ind=0; field_ind<LUT::NEQ; field_ind++){
+        wl[field_ind] = wl_lanes[field_ind][l];
+        wr[field_ind] = wr_lanes[field_ind][l];
+      }
+      enzo_float interface_velocity_i;
+      lutarray<LUT> fluxes = solve_interface(wl, wr, pl_lanes[l],
+                                             pr_lanes[l],
+                                             interface_velocity_i);
+      for (std::size_t field_ind=0; field_ind<LUT::NEQ; field_ind++){
+        flux_lanes[field_ind][l] = fluxes[field_ind];
+      }
+      vi_lanes[l] = interface_velocity_i;
+    }
+
+    // record the Riemann Fluxes of the valid lanes
+    for (std::size_t field_ind=0; field_ind<LUT::NEQ; field_ind++){
+      EFlt3DArray &flux_arr = flux_arrays[field_ind];
+      for (int l = 0; l < nl; l++){
+        flux_arr(iz,iy,ix0+l) = flux_lanes[field_ind][l];
+      }
+    }
+    if (velocity_i_bar_array != nullptr){
+      for (int l = 0; l < nl; l++){
+        (*velocity_i_bar_array)(iz,iy,ix0+l) = vi_lanes[l];
+      }
+    }
+  }
+}
+
 //----------------------------------------------------------------------
 
 template <class ImplFunctor>
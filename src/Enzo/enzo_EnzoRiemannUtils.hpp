@@ -194,36 +194,60 @@ namespace enzo_riemann_utils{
 
   //----------------------------------------------------------------------
 
-  /// Constructs an array of instances of EFlt3DArray that is organized
-  /// according to the LUT
+  /// Constructs a table relating each entry of the LUT to the index of the
+  /// corresponding array in map (the key of each array is only looked up
+  /// here). Entries of the LUT that map to -1 are assigned an index of 0.
   ///
   /// @param map The mapping that holds the array data
   /// @param dim Optional integer specifying which dimension is the ith
   ///   direction. This is used for mapping the i,j,k vector components listed
   ///   in lut to the x,y,z field components. Values of 0, 1, and 2 correspond
   ///   the ith direction pointing parallel to the x, y, and z directions,
-  ///   respectively. Note that each of the fields in grouping are assumed to
-  ///   be face-centered along this dimension (excluding the exterior faces of
-  ///   the mesh). This allows for appropriate loading of reconstructed fields.
+  ///   respectively.
   template<class LUT>
-  inline std::array<EFlt3DArray,LUT::NEQ> load_array_of_fields
-  (EnzoEFltArrayMap& map, int dim) noexcept
+  inline std::array<std::size_t,LUT::NEQ> map_index_table
+  (const EnzoEFltArrayMap& map, int dim) noexcept
   {
-    std::array<EFlt3DArray,LUT::NEQ> arr;
+    std::array<std::size_t,LUT::NEQ> table;
+    table.fill(0);
     // in the case where we don't have reconstructed values (dim = -1) we assume
     // that the that i-axis is aligned with the x-axis
     EnzoPermutedCoordinates coord( (dim == -1) ? 0 : dim);
 
-    // define a lambda function to execute for every member of lut. For each
-    // member in lut, its passed: 1. the member's name
-    //                            2. the associated index
-    auto fn = [coord, &arr, &map](std::string name, int index)
+    auto fn = [coord, &table, &map](std::string name, int index)
       {
-        if (index != -1){ arr[index] = map.at(parse_mem_name_(name, coord)); }
+        if (index != -1){
+          table[index] = map.index(parse_mem_name_(name, coord));
+        }
       };
 
     LUT::for_each_entry(fn);
+    return table;
+  }
+
+  //----------------------------------------------------------------------
 
+  /// Constructs an array of instances of EFlt3DArray that is organized
+  /// according to the LUT (i.e. the array associated with a quantity is
+  /// accessed with the compile-time index given by the LUT, like
+  /// `arr[LUT::density]`)
+  ///
+  /// @param map The mapping that holds the array data
+  /// @param dim Optional integer specifying which dimension is the ith
+  ///   direction. This is used for mapping the i,j,k vector components listed
+  ///   in lut to the x,y,z field components. Values of 0, 1, and 2 correspond
+  ///   the ith direction pointing parallel to the x, y, and z directions,
+  ///   respectively. Note that each of the fields in grouping are assumed to
+  ///   be face-centered along this dimension (excluding the exterior faces of
+  ///   the mesh). This allows for appropriate loading of reconstructed fields.
+  template<class LUT>
+  inline std::array<EFlt3DArray,LUT::NEQ> load_array_of_fields
+  (EnzoEFltArrayMap& map, int dim) noexcept
+  {
+    const std::array<std::size_t,LUT::NEQ> table =
+      map_index_table<LUT>(map, dim);
+    std::array<EFlt3DArray,LUT::NEQ> arr;
+    for (std::size_t i = 0; i < LUT::NEQ; i++){ arr[i] = map[table[i]]; }
     return arr;
   }
 
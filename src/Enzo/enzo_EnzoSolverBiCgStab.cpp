@@ -28,6 +28,22 @@
 /// LINE 15:     beta = (R*R0) / beta_n * (alpha/omega)
 /// LINE 16:     P = R + beta * (P - omega * V)
 /// LINE 17:  end for
+///
+/// Each iteration requires three global reductions: V*R0 (LINE 07),
+/// U*Q and U*U (LINE 12), and R*R and R*R0 (convergence test and LINE
+/// 15).  If merge_reductions_ is true, the last is folded into the
+/// second: since R = Q - omega * U (LINE 14),
+///
+///     R*R  = Q*Q - 2 omega U*Q + omega^2 U*U
+///     R*R0 = Q*R0 - omega U*R0
+///
+/// so Q*Q, Q*R0 and U*R0 are reduced along with U*Q and U*U.  This
+/// leaves two reductions per iteration, and the refresh for the next
+/// iteration's matrix-vector product no longer waits on a reduction.
+/// Because the expansion of R*R is subject to cancellation as the
+/// residual decreases, R*R and R*R0 are still reduced directly when
+/// the merged values indicate convergence or are dominated by
+/// round-off.
 
 #include "cello.hpp"
 #include "charm_simulation.hpp"
@@ -191,7 +207,8 @@ EnzoSolverBiCgStab::EnzoSolverBiCgStab
  int min_level, int max_level,
  int iter_max, double res_tol,
  int index_precon,
- int coarse_level
+ int coarse_level,
+ bool merge_reductions
  ) 
   : Solver(name,
 	   field_x,
@@ -211,7 +228,8 @@ EnzoSolverBiCgStab::EnzoSolverBiCgStab
     gx_(0), gy_(0), gz_(0),
     coarse_level_(coarse_level),
     ir_loop_3_(-1),
-    ir_loop_9_(-1)
+    ir_loop_9_(-1),
+    merge_reductions_(merge_reductions)
 {
 
   //  if (solve_type == solve_tree) {
@@ -242,6 +260,9 @@ EnzoSolverBiCgStab::EnzoSolverBiCgStab
   is_vs_ =     scalar_descr_quad->new_value("solver_bicgstab_vs");
   is_us_ =     scalar_descr_quad->new_value("solver_bicgstab_us");
   is_qs_ =     scalar_descr_quad->new_value("solver_bicgstab_qs");
+  is_qr0_ =    scalar_descr_quad->new_value("solver_bicgstab_qr0");
+  is_ur0_ =    scalar_descr_quad->new_value("solver_bicgstab_ur0");
+  is_qq_ =     scalar_descr_quad->new_value("solver_bicgstab_qq");
 
   if (solve_type == solve_tree) {
    
@@ -304,6 +325,9 @@ void EnzoSolverBiCgStab::pup(PUP::er& p) {
     p | is_qs_;
     p | is_dot_sync_;
     p | is_iter_;
+    p | is_qr0_;
+    p | is_ur0_;
+    p | is_qq_;
 
     p | res_tol_;
     p | index_precon_;
@@ -329,6 +353,7 @@ void EnzoSolverBiCgStab::pup(PUP::er& p) {
     p | coarse_level_;
     p | ir_loop_3_;
     p | ir_loop_9_;
+    p | merge_reductions_;
   }
 
 //----------------------------------------------------------------------
@@ -934,11 +959,14 @@ void EnzoSolverBiCgStab::loop_4(EnzoBlock* block) throw() {
   COPY_FIELD(block,iy_,"Y1_bcg");
   COPY_FIELD(block,ip_,"P1_bcg");
   
+  long double vr0 = 0.0;
+
   if (is_finest_(block)) {
 
     /// LINE 05: V = A * Y
+    /// LINE 07 [part]  vr0_ = V*R0
     
-    A_->matvec(iv_, iy_, block);
+    vr0 = A_->matvec_dot(iv_, iy_, ir0_, block);
 
   }
 
@@ -952,19 +980,7 @@ void EnzoSolverBiCgStab::loop_4(EnzoBlock* block) throw() {
   
   if (is_finest_(block)) {
     
-    enzo_float* R0 = (enzo_float*) field.values(ir0_);
-    enzo_float* V  = (enzo_float*) field.values(iv_);
-
-    /// LINE 07 [part]  vr0_ = V*R0
-    
-    for (int iz=gz_; iz<mz_-gz_; iz++) {
-      for (int iy=gy_; iy<my_-gy_; iy++) {
-	for (int ix=gx_; ix<mx_-gx_; ix++) {
-	  int i = ix + mx_*(iy + my_*iz);
-	  reduce[1] += V[i]*R0[i];
-	}
-      }
-    }
+    reduce[1] = vr0;
     
     /// for singular Poisson problems need all vectors in R(A), so
     /// project both Y and V into R(A)
@@ -1248,10 +1264,12 @@ void EnzoSolverBiCgStab::loop_10(EnzoBlock* block) throw() {
 
   COPY_FIELD(block,iu_,"U");
 
+  const int n = merge_reductions_ ? 8 : 5;
+
   std::vector<long double> reduce;
-  reduce.resize(5+1);
+  reduce.resize(n+1);
   reduce.clear();
-  reduce[0] = 5;
+  reduce[0] = n;
   
   if (is_finest_(block)) {
     
@@ -1260,13 +1278,37 @@ void EnzoSolverBiCgStab::loop_10(EnzoBlock* block) throw() {
     
     /// omega_n = DOT(U, Q)
     /// omega_d = DOT(U, U)
-  
-    for (int iz=gz_; iz<mz_-gz_; iz++) {
-      for (int iy=gy_; iy<my_-gy_; iy++) {
-	for (int ix=gx_; ix<mx_-gx_; ix++) {
-	  int i = ix + mx_*(iy + my_*iz);
-	  reduce[1] += U[i]*Q[i];
-	  reduce[2] += U[i]*U[i];
+
+    if (merge_reductions_) {
+
+      enzo_float* R0 = (enzo_float*) field.values(ir0_);
+
+      /// qr0_ = DOT(Q, R0)
+      /// ur0_ = DOT(U, R0)
+      /// qq_  = DOT(Q, Q)
+
+      for (int iz=gz_; iz<mz_-gz_; iz++) {
+	for (int iy=gy_; iy<my_-gy_; iy++) {
+	  for (int ix=gx_; ix<mx_-gx_; ix++) {
+	    int i = ix + mx_*(iy + my_*iz);
+	    reduce[1] += U[i]*Q[i];
+	    reduce[2] += U[i]*U[i];
+	    reduce[6] += Q[i]*R0[i];
+	    reduce[7] += U[i]*R0[i];
+	    reduce[8] += Q[i]*Q[i];
+	  }
+	}
+      }
+
+    } else {
+
+      for (int iz=gz_; iz<mz_-gz_; iz++) {
+	for (int iy=gy_; iy<my_-gy_; iy++) {
+	  for (int ix=gx_; ix<mx_-gx_; ix++) {
+	    int i = ix + mx_*(iy + my_*iz);
+	    reduce[1] += U[i]*Q[i];
+	    reduce[2] += U[i]*U[i];
+	  }
 	}
       }
     }
@@ -1298,12 +1340,17 @@ void EnzoSolverBiCgStab::loop_10(EnzoBlock* block) throw() {
 
   std::vector<int> is_array;
   if (solve_type_ == solve_tree) {
-    is_array.resize(5);
+    is_array.resize(n);
     is_array[0] = is_omega_n_;
     is_array[1] = is_omega_d_;
     is_array[2] = is_ys_;
     is_array[3] = is_us_;
     is_array[4] = is_qs_;
+    if (merge_reductions_) {
+      is_array[5] = is_qr0_;
+      is_array[6] = is_ur0_;
+      is_array[7] = is_qq_;
+    }
   }
 
 #ifdef DEBUG_REDUCE  
@@ -1324,7 +1371,7 @@ void EnzoSolverBiCgStab::loop_10(EnzoBlock* block) throw() {
 #endif    
 
   TRACE_DOT(block,"start",3);
-  inner_product_(block,5,&reduce[0],is_array,callback,bcg_loop_12);
+  inner_product_(block,n,&reduce[0],is_array,callback,bcg_loop_12);
     
 }
 
@@ -1348,14 +1395,20 @@ void EnzoSolverBiCgStab::loop_12(EnzoBlock* block,
 
   if (solve_type_ != solve_tree && msg != NULL) {
     long double* data = (long double*) msg->getData();
-    ASSERT1("EnzoSolverBiCgStab::loop_12",
-	    "Expecting (data[0] = %Lg) == 5",
-	    data[0],(data[0] == 5));
+    const int n = merge_reductions_ ? 8 : 5;
+    ASSERT2("EnzoSolverBiCgStab::loop_12",
+	    "Expecting (data[0] = %Lg) == %d",
+	    data[0],n,(data[0] == n));
     S(omega_n) = data[1];
     S(omega_d) = data[2];
     S(ys)      = data[3];
     S(us)      = data[4];
     S(qs)      = data[5];
+    if (merge_reductions_) {
+      S(qr0)   = data[6];
+      S(ur0)   = data[7];
+      S(qq)    = data[8];
+    }
   }
 
   delete msg;
@@ -1446,6 +1499,42 @@ void EnzoSolverBiCgStab::loop_12(EnzoBlock* block,
   /// Update previous beta value (beta_d_) to current value (beta_n_)
   
   S(beta_d) = S(beta_n);
+
+  if (merge_reductions_) {
+
+    /// R = Q - omega * U, so
+    ///
+    /// rr_     = DOT(Q,Q) - 2 omega DOT(U,Q) + omega^2 DOT(U,U)
+    /// beta_n_ = DOT(Q,R0) - omega DOT(U,R0)
+    ///
+    /// (omega_n_ and omega_d_ already account for the projection of
+    /// U, and the projection doesn't change DOT(U,R0) since R0 has
+    /// zero mean)
+
+    const long double omega = S(omega);
+    const long double rr =
+      S(qq) - 2.0*omega*S(omega_n) + omega*omega*S(omega_d);
+    const long double beta_n = S(qr0) - omega*S(ur0);
+
+    /// Use the merged values unless they are dominated by round-off
+    /// or indicate convergence, in which case fall back to reducing
+    /// DOT(R,R) and DOT(R,R0) directly.  Cancellation is judged relative
+    /// to the square root of the enzo_float machine epsilon (about 1e-8
+    /// in double precision)
+
+    const long double tol_cancel =
+      std::sqrt((long double)std::numeric_limits<enzo_float>::epsilon());
+    const bool is_accurate =
+      (rr > tol_cancel*S(qq)) &&
+      (std::abs(beta_n) > tol_cancel*std::abs(S(qr0)));
+
+    if (is_accurate && (sqrt(rr) / S(rho0) >= res_tol_)) {
+      S(rr)     = rr;
+      S(beta_n) = beta_n;
+      loop_14(block,NULL);
+      return;
+    }
+  }
   
   /// rr_     = DOT(R, R)
   /// beta_n = DOT(R, R0)
@@ -33,6 +33,10 @@ class EnzoSolverBiCgStab : public Solver {
   /// solvers (FFT, MG, etc.) for larger problems.  Alternately, a
   /// more scalable solver may be combined as a preconditioner for a
   /// robust and scalable overall solver.
+  ///
+  /// If merge_reductions is true, DOT(R,R) and DOT(R,R0) are computed
+  /// from inner products reduced along with DOT(U,Q) and DOT(U,U),
+  /// which removes one of the three global reductions per iteration.
 
 public: // interface
 
@@ -48,7 +52,8 @@ public: // interface
 		     int iter_max, 
 		     double res_tol,
 		     int index_precon,
-		     int coarse_level);
+		     int coarse_level,
+		     bool merge_reductions = false);
 
   /// default constructor
   EnzoSolverBiCgStab()
@@ -60,6 +65,7 @@ public: // interface
       is_r0s_(-1),    is_c_(-1),       is_bs_(-1),       is_xs_(-1),
       is_bnorm_(-1),  is_vr0_(-1),     is_ys_(-1),       is_vs_(-1),
       is_us_(-1),     is_qs_(-1),      is_dot_sync_(-1), is_iter_(-1),
+      is_qr0_(-1),    is_ur0_(-1),     is_qq_(-1),
       res_tol_(0),
       index_precon_(-1),
       iter_max_(-1),
@@ -75,7 +81,8 @@ public: // interface
       gx_(0), gy_(0), gz_(0),
       coarse_level_(0),
       ir_loop_3_(-1),
-      ir_loop_9_(-1)
+      ir_loop_9_(-1),
+      merge_reductions_(false)
   {};
 
   /// Charm++ PUP::able declarations
@@ -91,6 +98,7 @@ public: // interface
       is_r0s_(-1),    is_c_(-1),       is_bs_(-1),       is_xs_(-1),
       is_bnorm_(-1),  is_vr0_(-1),     is_ys_(-1),       is_vs_(-1),
       is_us_(-1),     is_qs_(-1),      is_dot_sync_(-1), is_iter_(-1),
+      is_qr0_(-1),    is_ur0_(-1),     is_qq_(-1),
       res_tol_(0.0),
       index_precon_(-1),
       iter_max_(0), 
@@ -100,8 +108,8 @@ public: // interface
       gx_(0), gy_(0), gz_(0),
       coarse_level_(0),
       ir_loop_3_(-1),
-      ir_loop_9_(-1)
-          
+      ir_loop_9_(-1),
+      merge_reductions_(false)
   {}
 
   /// Charm++ Pack / Unpack function
@@ -144,11 +152,13 @@ public: // interface
   void loop_85(EnzoBlock* enzo_block) throw();
 
   /// Second matrix-vector product, begins DOT(U,U), DOT(U,Q) and
-  /// projection of Y and U
+  /// projection of Y and U (and DOT(Q,R0), DOT(U,R0), DOT(Q,Q) if
+  /// merge_reductions_)
   void loop_10(EnzoBlock* enzo_block) throw();
 
   /// Shifts Y and U, second vector updates, begins DOT(R,R) and
-  /// DOT(R,R0)
+  /// DOT(R,R0) (unless merge_reductions_, in which case they are
+  /// usually computed from the loop_10 dot products)
   void loop_12(EnzoBlock* enzo_block, CkReductionMsg * ) throw();
 
   /// Updates search direction, begins update on iteration counter
@@ -277,6 +287,9 @@ protected: // attributes
   int is_qs_;
   int is_dot_sync_;
   int is_iter_;
+  int is_qr0_;
+  int is_ur0_;
+  int is_qq_;
 
   typedef void (EnzoSolverBiCgStab::*enzo_solver_bicgstab_member)(EnzoBlock *, CkReductionMsg *) ;
   
@@ -309,6 +322,10 @@ protected: // attributes
   /// Refresh id's
   int ir_loop_3_;
   int ir_loop_9_;
+
+  /// Whether to merge the DOT(R,R) and DOT(R,R0) reduction into the
+  /// preceding reduction, leaving two global reductions per iteration
+  bool merge_reductions_;
 };
 
 #endif /* ENZO_ENZO_SOLVER_BICGSTAB_HPP */
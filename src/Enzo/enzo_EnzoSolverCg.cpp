@@ -472,18 +472,14 @@ void EnzoSolverCg::loop_2b (EnzoBlock * enzo_block) throw()
     Data * data = enzo_block->data();
     Field field = data->field();
 
-    if (is_finest_(enzo_block)) {
-
-      A_->matvec(iy_,id_,enzo_block);
-
-    }
-
     long double reduce[3] = {0.0, 0.0, 0.0};
 
     if (is_finest_(enzo_block)) {
 
-      enzo_float * D = (enzo_float*) field.values(id_);
-      enzo_float * Y = (enzo_float*) field.values(iy_);
+      // Y = A*D and DOT(D,Y)
+
+      reduce[2] = A_->matvec_dot(iy_,id_,id_,enzo_block);
+
       enzo_float * R = (enzo_float*) field.values(ir_);
       enzo_float * Z = (enzo_float*) field.values(iz_);
 
@@ -493,7 +489,6 @@ void EnzoSolverCg::loop_2b (EnzoBlock * enzo_block) throw()
 	    int i = ix + mx_*(iy + my_*iz);
 	    reduce[0] += R[i]*R[i];
 	    reduce[1] += R[i]*Z[i];
-	    reduce[2] += D[i]*Y[i];
 	  }
 	}
       }
@@ -780,18 +775,16 @@ void EnzoSolverCg::local_cg_(EnzoBlock * enzo_block)
 
     refresh_local_(id_,enzo_block);
 
-    A_->matvec(iy_,id_,enzo_block);
+    dy_ = A_->matvec_dot(iy_,id_,id_,enzo_block);
 
     rr_ = 0.0;
     rz_ = 0.0;
-    dy_ = 0.0;
     for (int iz=gz_; iz<mz_-gz_; iz++) {
       for (int iy=gy_; iy<my_-gy_; iy++) {
 	for (int ix=gx_; ix<mx_-gx_; ix++) {
 	  int i = ix + mx_*(iy + my_*iz);
 	  rr_ += R[i]*R[i];
 	  rz_ += R[i]*Z[i];
-	  dy_ += D[i]*Y[i];
 	}
       }
     }
@@ -8,7 +8,6 @@
 #include "cello.hpp"
 #include "enzo.hpp"
 
-// #define DEBUG_COPY
 // #define DEBUG_SOLVER
 // #define DEBUG_NEW_REFRESH
 // #define DEBUG_TRACE
@@ -65,7 +64,7 @@ EnzoSolverJacobi::EnzoSolverJacobi
   int monitor_iter,
   int restart_cycle,
   int solve_type,
-  double weight, int iter_max) throw()
+  double weight, int iter_max, int sweeps_per_refresh) throw()
   : Solver(name,
 	   field_x,
 	   field_b,
@@ -77,7 +76,9 @@ EnzoSolverJacobi::EnzoSolverJacobi
     id_ (-1),
     w_(weight),
     n_(iter_max),
-    ir_smooth_(-1)
+    ir_smooth_(-1),
+    sweeps_per_refresh_(std::max(1,sweeps_per_refresh)),
+    ir_smooth_b_(-1)
 {
   // Reserve temporary fields
 
@@ -113,6 +114,21 @@ EnzoSolverJacobi::EnzoSolverJacobi
 #endif  
   refresh_smooth->set_callback(CkIndex_EnzoBlock::p_solver_jacobi_continue());
 
+  if (sweeps_per_refresh_ > 1) {
+
+    // Sweeps into the ghost zones require B to be valid there too
+
+    ir_smooth_b_ = add_new_refresh_();
+
+    Refresh * refresh_smooth_b = cello::refresh(ir_smooth_b_);
+    cello::simulation()->new_refresh_set_name(ir_smooth_b_,name+":smooth_b");
+
+    refresh_smooth_b->add_field (ix_);
+    refresh_smooth_b->add_field (ib_);
+    refresh_smooth_b->set_solver_id(index());
+    refresh_smooth_b->set_callback
+      (CkIndex_EnzoBlock::p_solver_jacobi_continue());
+  }
 }
 
 //----------------------------------------------------------------------
@@ -138,7 +154,7 @@ void EnzoSolverJacobi::apply
   
   // Refresh X
 
-  do_refresh_(block);
+  do_refresh_(block,true);
 }
 
 //----------------------------------------------------------------------
@@ -194,69 +210,51 @@ void EnzoSolverJacobi::apply_(Block * block)
   // field.ghost_depth(ix_,&gx,&gy,&gz);
 
   const int ng = A_->ghost_depth();
-  const int gx = (mx > 1) ? ng : 0;
-  const int gy = (my > 1) ? ng : 0;
-  const int gz = (mz > 1) ? ng : 0;
+
+  // Perform up to sweeps_per_refresh_ sweeps before refreshing X.
+  // Each sweep invalidates the outermost ng layers of the region
+  // updated by the previous sweep, so sweep j updates the region
+  // j*ng cells from the Block edges
+
+  const int num_sweeps = std::min(n_ - (*piter_(block)),
+                                  num_sweeps_(field,ng));
 
   if (is_finest_(block)) {
 
-    A_->diagonal (id_, block,ng);
-    A_->residual (ir_, ib_, ix_, block,ng);
-
-#ifdef DEBUG_COPY
-    {
-      enzo_float * R = (enzo_float*) field.values(ir_);
-      enzo_float * R_J = (enzo_float*) field.values("R_J");
-      enzo_float * D = (enzo_float*) field.values(id_);
-      enzo_float * D_J = (enzo_float*) field.values("D_J");
-      enzo_float * X = (enzo_float*) field.values(ix_);
-      enzo_float * X_J = (enzo_float*) field.values("X_J");
-      enzo_float * B = (enzo_float*) field.values(ib_);
-      enzo_float * B_J = (enzo_float*) field.values("B_J");
-      double rsum=0.0;
-      double dsum=0.0;
-      double xsum=0.0;
-      double bsum=0.0;
-      for (int i=0; i<mx*my*mz; i++) {
-	R_J[i]=R[i];
-	D_J[i]=D[i];
-	X_J[i]=X[i];
-	B_J[i]=B[i];
-	rsum+=std::abs(R[i]);
-	dsum+=std::abs(D[i]);
-	xsum+=X[i];
-	bsum+=std::abs(B[i]);
-      }
-      CkPrintf ("DEBUG_COPY rsum dsum xsum bsum %g %g %g %g\n",rsum,dsum,xsum,bsum);
-    }
-#endif    
-    enzo_float * X = (enzo_float*) field.values(ix_);
-    enzo_float * R = (enzo_float*) field.values(ir_);
-    enzo_float * D = (enzo_float*) field.values(id_);
-
-    if (w_ == 1.0) {
-      for (int iz=gz; iz<mz-gz; iz++) {
-	for (int iy=gy; iy<my-gy; iy++) {
-	  for (int ix=gx; ix<mx-gx; ix++) {
-	    int i = ix + mx*(iy + my*iz);
-	    X[i] += R[i] / D[i];
-	  }
-	}
-      }
-    } else {
-      for (int iz=gz; iz<mz-gz; iz++) {
-	for (int iy=gy; iy<my-gy; iy++) {
-	  for (int ix=gx; ix<mx-gx; ix++) {
-	    int i = ix + mx*(iy + my*iz);
-	    X[i] = w_*(R[i] / D[i]) + (1.0-w_)*X[i];
-	  }
-	}
+    // With more than one sweep per refresh, ghost zones along
+    // non-periodic domain boundaries hold boundary values, so are never
+    // updated.  A single sweep per refresh updates the same region on
+    // all Blocks, as in the original single-sweep smoother
+
+    const bool keep_boundary = (sweeps_per_refresh_ > 1);
+    int g3[3];
+    field.ghost_depth(ix_,&g3[0],&g3[1],&g3[2]);
+    bool is_boundary[3][2];
+    block->is_on_boundary(is_boundary);
+    bool periodic[3];
+    block->periodicity(periodic);
+    const int m3[3] = {mx,my,mz};
+
+    for (int sweep=1; sweep<=num_sweeps; sweep++) {
+
+      const int g0 = sweep*ng;
+      int gl3[3],gu3[3];
+      for (int axis=0; axis<3; axis++) {
+        gl3[axis] = (keep_boundary && is_boundary[axis][0] && ! periodic[axis])
+          ? g3[axis] : g0;
+        gu3[axis] = (keep_boundary && is_boundary[axis][1] && ! periodic[axis])
+          ? g3[axis] : g0;
+        if (m3[axis] == 1) gl3[axis] = gu3[axis] = 0;
       }
+
+      // X <-- X + w*(B - A*X)/D
+
+      A_->jacobi_sweep (ix_, ib_, ir_, id_, w_, block, gl3, gu3);
     }
   }
   // Next iteration
 
-  (*piter_(block))++;
+  (*piter_(block)) += num_sweeps;
   
   // Refresh X
 
@@ -266,22 +264,44 @@ void EnzoSolverJacobi::apply_(Block * block)
 
 //----------------------------------------------------------------------
 
-void EnzoSolverJacobi::do_refresh_(Block * block)
+void EnzoSolverJacobi::do_refresh_(Block * block, bool first)
 {
   TRACE_JACOBI(block,this,"do_refresh()");
+
+  const int ir = (first && ir_smooth_b_ >= 0) ? ir_smooth_b_ : ir_smooth_;
 #ifdef DEBUG_NEW_REFRESH  
-  CkPrintf ("DEBUG_NEW_REFRESH %s:%d ir_smooth=%d\n",__FILE__,__LINE__,ir_smooth_);
+  CkPrintf ("DEBUG_NEW_REFRESH %s:%d ir_smooth=%d\n",__FILE__,__LINE__,ir);
 #endif  
-  Refresh * refresh = cello::refresh(ir_smooth_);
+  Refresh * refresh = cello::refresh(ir);
 
   refresh->set_active(is_finest_(block));
   refresh->add_field (ix_);
+  if (ir == ir_smooth_b_) refresh->add_field (ib_);
   
 #ifdef DEBUG_NEW_REFRESH  
-  CkPrintf ("DEBUG_NEW_REFRESH %s:%d ir_smooth=%d\n",__FILE__,__LINE__,ir_smooth_);
+  CkPrintf ("DEBUG_NEW_REFRESH %s:%d ir_smooth=%d\n",__FILE__,__LINE__,ir);
 #endif  
   block->new_refresh_start
-    (ir_smooth_, CkIndex_EnzoBlock::p_solver_jacobi_continue());
+    (ir, CkIndex_EnzoBlock::p_solver_jacobi_continue());
+}
+
+//----------------------------------------------------------------------
+
+int EnzoSolverJacobi::num_sweeps_(Field field, int ng) const
+{
+  int mx,my,mz;
+  field.dimensions(ix_,&mx,&my,&mz);
+  int gx,gy,gz;
+  field.ghost_depth(ix_,&gx,&gy,&gz);
+
+  // X must remain valid in the Block interior after the last sweep
+
+  int g = std::numeric_limits<int>::max();
+  if (mx > 1) g = std::min(g,gx);
+  if (my > 1) g = std::min(g,gy);
+  if (mz > 1) g = std::min(g,gz);
+
+  return std::max(1,std::min(sweeps_per_refresh_, g / std::max(1,ng)));
 }
 
 //----------------------------------------------------------------------
@@ -12,7 +12,20 @@ class EnzoSolverJacobi : public Solver {
 
   /// @class    EnzoSolverJacobi
   /// @ingroup  Enzo
-  /// @brief    [\ref Enzo] 
+  /// @brief    [\ref Enzo] Weighted Jacobi smoother
+  ///
+  /// Performs iter_max weighted Jacobi sweeps X <-- X + w*(B - A*X)/D
+  /// on A*X = B, where D is the diagonal of A.  By default
+  /// the ghost zones of X are refreshed after every sweep.  If
+  /// sweeps_per_refresh k > 1, up to k sweeps are performed between
+  /// refreshes: sweep j = 1,...,k updates X on the array excluding the
+  /// outer j*g cells along each edge, where g is the matrix ghost
+  /// depth, since each sweep leaves the outer g cells of the region it
+  /// updated stale.  k is limited so that k*g does not exceed the Field
+  /// ghost depth, which keeps the Block interior correct after the
+  /// k'th sweep, and B is refreshed along with X before the first
+  /// sweep.  Ghost zones along non-periodic domain boundaries are not
+  /// updated by sweeps.
 
 public: // interface
 
@@ -24,7 +37,8 @@ public: // interface
 		   int restart_cycle,
 		   int solve_type,
 		   double weight=1.0,
-		   int iter_max = 1) throw();
+		   int iter_max = 1,
+		   int sweeps_per_refresh = 1) throw();
 
   /// Charm++ PUP::able declarations
   PUPable_decl(EnzoSolverJacobi);
@@ -38,7 +52,9 @@ public: // interface
       w_(0),
       i_iter_(-1),
       n_(0),
-      ir_smooth_(-1)
+      ir_smooth_(-1),
+      sweeps_per_refresh_(1),
+      ir_smooth_b_(-1)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -54,6 +70,8 @@ public: // interface
     p | i_iter_;
     p | n_;
     p | ir_smooth_;
+    p | sweeps_per_refresh_;
+    p | ir_smooth_b_;
   }
 
 public: // virtual methods
@@ -98,8 +116,13 @@ protected: // methods
   /// Implementation of solver() for given precision 
   void apply_(Block * block);
 
-  /// Refresh after computing
-  void do_refresh_(Block * block);
+  /// Refresh after computing; the first refresh also refreshes B
+  /// if more than one sweep is performed per refresh
+  void do_refresh_(Block * block, bool first = false);
+
+  /// Number of sweeps that can be performed before the next refresh
+  /// given the Field ghost depth and the matrix stencil width
+  int num_sweeps_(Field field, int ng) const;
 
   /// Allocate temporary Fields
   void allocate_temporary_(Field field, Block * block = NULL)
@@ -146,6 +169,13 @@ protected: // attributes
 
   // Refresh after each smoothing
   int ir_smooth_;
+
+  /// Maximum number of sweeps between refreshes of X
+  int sweeps_per_refresh_;
+
+  /// Refresh of both X and B before the first sweep, or -1 if
+  /// sweeps_per_refresh_ is 1
+  int ir_smooth_b_;
 };
 
 #endif /* ENZO_ENZO_SOLVER_JACOBI_HPP */
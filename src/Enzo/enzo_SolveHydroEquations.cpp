@@ -8,9 +8,84 @@
 #include "cello.hpp"
 #include "enzo.hpp"
 #include <stdio.h>
+#include <atomic>
+
+#ifdef CONFIG_USE_CKLOOP
+#  include "CkLoopAPI.h"
+#endif
 
 // #define IE_ERROR_FIELD
 // #define DEBUG_PPM
+
+//----------------------------------------------------------------------
+
+/// Arguments to ppm_de_sweep() shared by all slice ranges of one
+/// directional sweep
+struct PpmSweep {
+  int idir;
+  enzo_float *d, *E, *u, *v, *w, *ge;
+  int *gravity_on;
+  enzo_float *gr_ax, *gr_ay, *gr_az;
+  enzo_float *gamma, *dt;
+  enzo_float *dx, *dy, *dz;
+  int *in, *jn, *kn;
+  int *is, *ie;
+  int *flatten, *pressure_free;
+  int *iconsrec, *iposrec;
+  int *diffusion, *steepening, *dual;
+  enzo_float *eta1, *eta2;
+  int *num_subgrids, *leftface, *rightface;
+  int *istart, *iend, *jstart, *jend;
+  enzo_float *standard;
+  int *dindex, *Eindex, *uindex, *vindex, *windex, *geindex;
+  int *ncolor;
+  enzo_float *colorpt;
+  int *coloff, *colindex;
+  /// Size of the scratch array for each slice range
+  int tempsize;
+  /// Last nonzero error returned by ppm_de_sweep()
+  std::atomic<int> error;
+};
+
+//----------------------------------------------------------------------
+
+/// Sweep slices first through last (zero-based, inclusive) with
+/// private scratch space.  Signature matches CkLoop's HelperFn
+static void ppm_sweep_slices_
+(int first, int last, void * result, int param_num, void * param)
+{
+  PpmSweep * sweep = (PpmSweep *) param;
+
+  enzo_float * temp =
+    EnzoHydroWorkspace::instance()->range_temp(sweep->tempsize);
+  int n1 = first + 1;
+  int n2 = last + 1;
+  int error = 0;
+  int num_ie_error = -1;
+
+  FORTRAN_NAME(ppm_de_sweep)
+    (&sweep->idir, &n1, &n2,
+     sweep->d, sweep->E, sweep->u, sweep->v, sweep->w, sweep->ge,
+     sweep->gravity_on, sweep->gr_ax, sweep->gr_ay, sweep->gr_az,
+     sweep->gamma, sweep->dt,
+     sweep->dx, sweep->dy, sweep->dz,
+     sweep->in, sweep->jn, sweep->kn,
+     sweep->is, sweep->ie,
+     sweep->flatten, sweep->pressure_free,
+     sweep->iconsrec, sweep->iposrec,
+     sweep->diffusion, sweep->steepening, sweep->dual,
+     sweep->eta1, sweep->eta2,
+     sweep->num_subgrids, sweep->leftface, sweep->rightface,
+     sweep->istart, sweep->iend, sweep->jstart, sweep->jend,
+     sweep->standard, sweep->dindex, sweep->Eindex,
+     sweep->uindex, sweep->vindex, sweep->windex, sweep->geindex,
+     temp,
+     sweep->ncolor, sweep->colorpt, sweep->coloff, sweep->colindex,
+     &error, nullptr, nullptr, nullptr, &num_ie_error);
+
+  if (error != 0) sweep->error = error;
+}
+
 //----------------------------------------------------------------------
 
 int EnzoBlock::SolveHydroEquations
@@ -24,6 +99,10 @@ int EnzoBlock::SolveHydroEquations
 
   int dim, size;
 
+  // Temporary arrays are reused from the previous Block on this process
+
+  EnzoHydroWorkspace * workspace = EnzoHydroWorkspace::instance();
+
   Field field = data()->field();
   int gx,gy,gz;
   int mx,my,mz;
@@ -32,9 +111,9 @@ int EnzoBlock::SolveHydroEquations
 
 #ifdef IE_ERROR_FIELD
   int num_ie_error = 0;
-  int *ie_error_x = new int [mx*my*mz];
-  int *ie_error_y = new int [mx*my*mz];
-  int *ie_error_z = new int [mx*my*mz];
+  int *ie_error_x = workspace->ie_error(0,mx*my*mz);
+  int *ie_error_y = workspace->ie_error(1,mx*my*mz);
+  int *ie_error_z = workspace->ie_error(2,mx*my*mz);
 #else
   int num_ie_error = -1;
   int *ie_error_x = nullptr;
@@ -55,7 +134,7 @@ int EnzoBlock::SolveHydroEquations
   enzo_float * colorpt = (enzo_float *) field.permanent();
 
   // coloff: offsets into the color array (for each color field)
-  int * coloff   = (ncolor > 0) ? (new int [ncolor]) : NULL;
+  int * coloff   = (ncolor > 0) ? workspace->coloff(ncolor) : NULL;
   int index_color = 0;
   for (int index_field = 0;
        index_field < field.field_count();
@@ -95,14 +174,14 @@ int EnzoBlock::SolveHydroEquations
   if (rank >= 2) {
     velocity_y = (enzo_float *) field.values("velocity_y");
   } else {
-    velocity_y = new enzo_float[size];
+    velocity_y = workspace->velocity(1,size);
     for (int i=0; i<size; i++) velocity_y[i] = 0.0;
   }
 
     if (rank >= 3) {
     velocity_z = (enzo_float *) field.values("velocity_z");
   } else {
-    velocity_z = new enzo_float[size];
+    velocity_z = workspace->velocity(2,size);
     for (int i=0; i<size; i++) velocity_z[i] = 0.0;
   }
 
@@ -148,13 +227,13 @@ int EnzoBlock::SolveHydroEquations
 			 GridDimension[1]*GridDimension[2]),
 		     GridDimension[2]*GridDimension[0]);
 
-  enzo_float *temp = new enzo_float[tempsize*(32+ncolor*4)];
+  enzo_float *temp = workspace->temp(tempsize*(32+ncolor*4));
 
   /* create and fill in arrays which are easier for the solver to
      understand. */
 
   size = NumberOfSubgrids*3*(18+2*ncolor) + 1;
-  int * array = new int[size];
+  int * array = workspace->array(size);
   for (int i=0; i<size; i++) array[i] = 0;
 
   int * p = array;
@@ -242,7 +321,7 @@ int EnzoBlock::SolveHydroEquations
 
   enzo_float * CellWidthTemp[MAX_DIMENSION];
   for (dim = 0; dim < MAX_DIMENSION; dim++) {
-    CellWidthTemp[dim] = new enzo_float [GridDimension[dim]];
+    CellWidthTemp[dim] = workspace->cell_width(dim,GridDimension[dim]);
     if (dim < rank) {
       for (int i=0; i<GridDimension[dim]; i++)
 	CellWidthTemp[dim][i] = (cosmo_a*CellWidth[dim]);
@@ -265,31 +344,121 @@ int EnzoBlock::SolveHydroEquations
 
   int error = 0;
 
-  FORTRAN_NAME(ppm_de)
-    (
-     density, total_energy, velocity_x, velocity_y, velocity_z,
-     internal_energy,
-     &gravity_on,
-     acceleration_x,
-     acceleration_y,
-     acceleration_z,
-     &Gamma[in], &dt, &cycle_,
-     CellWidthTemp[0], CellWidthTemp[1], CellWidthTemp[2],
-     &rank, &GridDimension[0], &GridDimension[1],
-     &GridDimension[2], GridStartIndex, GridEndIndex,
-     &PPMFlatteningParameter[in],
-     &PressureFree[in],
-     &iconsrec, &iposrec,
-     &PPMDiffusionParameter[in], &PPMSteepeningParameter[in],
-     &DualEnergyFormalism[in], &DualEnergyFormalismEta1[in],
-     &DualEnergyFormalismEta2[in],
-     &NumberOfSubgrids, leftface, rightface,
-     istart, iend, jstart, jend,
-     standard, dindex, Eindex, uindex, vindex, windex,
-     geindex, temp,
-     &ncolor, colorpt, coloff, colindex,
-     &error, ie_error_x,ie_error_y,ie_error_z,&num_ie_error
-     );
+  const int num_threads = PPMThreads[in];
+
+  if (num_threads > 1 && num_ie_error < 0) {
+
+    // Sweep independent slices concurrently, each slice range with
+    // its own scratch space; directions ordered as in ppm_de
+
+    PpmSweep sweep;
+    sweep.d  = density;
+    sweep.E  = total_energy;
+    sweep.u  = velocity_x;
+    sweep.v  = velocity_y;
+    sweep.w  = velocity_z;
+    sweep.ge = internal_energy;
+    sweep.gravity_on = &gravity_on;
+    sweep.gr_ax = acceleration_x;
+    sweep.gr_ay = acceleration_y;
+    sweep.gr_az = acceleration_z;
+    sweep.gamma = &Gamma[in];
+    sweep.dt    = &dt;
+    sweep.dx = CellWidthTemp[0];
+    sweep.dy = CellWidthTemp[1];
+    sweep.dz = CellWidthTemp[2];
+    sweep.in = &GridDimension[0];
+    sweep.jn = &GridDimension[1];
+    sweep.kn = &GridDimension[2];
+    sweep.is = GridStartIndex;
+    sweep.ie = GridEndIndex;
+    sweep.flatten       = &PPMFlatteningParameter[in];
+    sweep.pressure_free = &PressureFree[in];
+    sweep.iconsrec = &iconsrec;
+    sweep.iposrec  = &iposrec;
+    sweep.diffusion  = &PPMDiffusionParameter[in];
+    sweep.steepening = &PPMSteepeningParameter[in];
+    sweep.dual = &DualEnergyFormalism[in];
+    sweep.eta1 = &DualEnergyFormalismEta1[in];
+    sweep.eta2 = &DualEnergyFormalismEta2[in];
+    sweep.num_subgrids = &NumberOfSubgrids;
+    sweep.leftface  = leftface;
+    sweep.rightface = rightface;
+    sweep.istart = istart;
+    sweep.iend   = iend;
+    sweep.jstart = jstart;
+    sweep.jend   = jend;
+    sweep.standard = standard;
+    sweep.dindex  = dindex;
+    sweep.Eindex  = Eindex;
+    sweep.uindex  = uindex;
+    sweep.vindex  = vindex;
+    sweep.windex  = windex;
+    sweep.geindex = geindex;
+    sweep.ncolor   = &ncolor;
+    sweep.colorpt  = colorpt;
+    sweep.coloff   = coloff;
+    sweep.colindex = colindex;
+    sweep.tempsize = tempsize*(32+ncolor*4);
+    sweep.error = 0;
+
+    // x sweeps are over k slices, y over i, and z over j
+    const int axis_slice[3] = {2,0,1};
+
+    const int ixyz = cycle_ % rank;
+    for (int n=ixyz; n<ixyz+rank; n++) {
+
+      sweep.idir = n % rank;
+
+      const int idir = sweep.idir;
+      if (GridEndIndex[idir] - GridStartIndex[idir] + 1 <= 1) continue;
+
+      const int num_slices = GridDimension[axis_slice[idir]];
+      const int num_chunks = MIN(num_threads,num_slices);
+
+#ifdef CONFIG_USE_CKLOOP
+      CkLoop_Parallelize
+        (ppm_sweep_slices_, 1, &sweep, num_chunks, 0, num_slices - 1);
+#else
+      for (int chunk=0; chunk<num_chunks; chunk++) {
+        const int first = (chunk*num_slices)/num_chunks;
+        const int last  = ((chunk+1)*num_slices)/num_chunks - 1;
+        ppm_sweep_slices_ (first, last, nullptr, 1, &sweep);
+      }
+#endif
+    }
+
+    error = sweep.error;
+
+  } else {
+
+    FORTRAN_NAME(ppm_de)
+      (
+       density, total_energy, velocity_x, velocity_y, velocity_z,
+       internal_energy,
+       &gravity_on,
+       acceleration_x,
+       acceleration_y,
+       acceleration_z,
+       &Gamma[in], &dt, &cycle_,
+       CellWidthTemp[0], CellWidthTemp[1], CellWidthTemp[2],
+       &rank, &GridDimension[0], &GridDimension[1],
+       &GridDimension[2], GridStartIndex, GridEndIndex,
+       &PPMFlatteningParameter[in],
+       &PressureFree[in],
+       &iconsrec, &iposrec,
+       &PPMDiffusionParameter[in], &PPMSteepeningParameter[in],
+       &DualEnergyFormalism[in], &DualEnergyFormalismEta1[in],
+       &DualEnergyFormalismEta2[in],
+       &NumberOfSubgrids, leftface, rightface,
+       istart, iend, jstart, jend,
+       standard, dindex, Eindex, uindex, vindex, windex,
+       geindex, temp,
+       &ncolor, colorpt, coloff, colindex,
+       &error, ie_error_x,ie_error_y,ie_error_z,&num_ie_error
+       );
+
+  }
 
   if (error != 0) {
     char buffer[256];
@@ -313,24 +482,8 @@ int EnzoBlock::SolveHydroEquations
   }
 #endif
 
-  for (dim = 0; dim < MAX_DIMENSION; dim++) {
-    delete [] CellWidthTemp[dim];
-  }
-
-  /* deallocate temporary space for solver */
-
-  delete [] temp;
-  if (rank < 2) delete [] velocity_y;
-  if (rank < 3) delete [] velocity_z;
-
-  delete [] array;
-
-  delete [] coloff;
-#ifdef IE_ERROR_FIELD
-  delete [] ie_error_x;
-  delete [] ie_error_y;
-  delete [] ie_error_z;
-#endif
+  /* temporary space for solver is kept in the workspace for the
+     next Block */
 
   return ENZO_SUCCESS;
 
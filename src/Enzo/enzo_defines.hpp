@@ -45,4 +45,17 @@
 #define HDIDensity       18
 #define Metallicity      19
 
+/// Loop annotation asking the compiler to vectorize the following loop
+#if defined(_OPENMP)
+#  define ENZO_SIMD_LOOP _Pragma("omp simd")
+#elif defined(__INTEL_COMPILER)
+#  define ENZO_SIMD_LOOP _Pragma("simd")
+#elif defined(__clang__)
+#  define ENZO_SIMD_LOOP _Pragma("clang loop vectorize(enable)")
+#elif defined(__GNUC__)
+#  define ENZO_SIMD_LOOP _Pragma("GCC ivdep")
+#else
+#  define ENZO_SIMD_LOOP
+#endif
+
 #endif /* ENZO_DEFINES_HPP */
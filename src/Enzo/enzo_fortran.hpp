@@ -92,6 +92,32 @@ extern "C" void FORTRAN_NAME(ppm_de)
    int *num_ie_error
    );
 
+extern "C" void FORTRAN_NAME(ppm_de_sweep)
+  (int *idir, int *n1, int *n2,
+   enzo_float *d, enzo_float *E, enzo_float *u, enzo_float *v, enzo_float *w,
+   enzo_float *ge,
+   int *grav, enzo_float *gr_ax, enzo_float *gr_ay, enzo_float *gr_az,
+   enzo_float *gamma, enzo_float *dt,
+   enzo_float dx[], enzo_float dy[], enzo_float dz[],
+   int *in, int *jn, int *kn,
+   int is[], int ie[],
+   int *flatten, int *ipresfree,
+   int * iconsrec, int *iposrec,
+   int *diff, int *steepen, int *idual,
+   enzo_float *eta1, enzo_float *eta2,
+   int *num_subgrids, int leftface[], int rightface[],
+   int istart[], int iend[], int jstart[], int jend[],
+   enzo_float *standard, int dindex[], int Eindex[],
+   int uindex[], int vindex[], int windex[],
+   int geindex[], enzo_float *temp,
+   int *ncolor, enzo_float *colorpt, int *coloff,
+   int colindex[], int *error,
+   int *ie_error_x,
+   int *ie_error_y,
+   int *ie_error_z,
+   int *num_ie_error
+   );
+
 extern "C" void FORTRAN_NAME(ppml)
   (enzo_float *dn,   enzo_float *vx,   enzo_float *vy,   enzo_float *vz,
    enzo_float *bx,   enzo_float *by,   enzo_float *bz,
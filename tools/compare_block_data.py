@@ -0,0 +1,120 @@
+#!/usr/bin/env python
+# this currently works with python 2 or 3
+
+import argparse
+import glob
+
+import h5py
+import numpy as np
+
+from test_report import create_test_report
+
+_description = '''\
+Compares the Block datasets written by enzo-e "data" outputs, and
+reports whether they are identical.
+'''
+
+_epilog = '''\
+blocks mode
+===========
+  Compare two sets of "data" output files, given as glob patterns. Every
+  Block group must hold the same datasets with identical values.
+
+  Example Usage:
+    compare_block_data.py test.unit blocks 'ref-p*.h5' 'target-p*.h5'
+
+shared mode
+===========
+  Compare "data_shared" output files with "data" output files of the
+  same fields.  Every Block in the shared files must match the field
+  datasets of the Block group with the same name.
+
+  Example Usage:
+    compare_block_data.py test.unit shared 'data-p*-10.h5' 'shared-10.h5'
+'''
+
+def _block_datasets(pattern):
+    """
+    Returns a dict mapping (block name, dataset name) to the array of each
+    dataset in the Block groups of the files matching pattern
+    """
+    datasets = {}
+    file_names = sorted(glob.glob(pattern))
+    if len(file_names) == 0:
+        raise ValueError("no files match {}".format(pattern))
+    for file_name in file_names:
+        with h5py.File(file_name,'r') as f:
+            for block_name, group in f.items():
+                if not isinstance(group, h5py.Group):
+                    continue
+                def add(name, item, block_name = block_name):
+                    if isinstance(item, h5py.Dataset):
+                        datasets[(block_name,name)] = item[()]
+                group.visititems(add)
+    return datasets
+
+def _shared_datasets(pattern):
+    """
+    Returns a dict mapping (block name, dataset name) to the array of each
+    Block's field data in the "data_shared" files matching pattern
+    """
+    datasets = {}
+    file_names = sorted(glob.glob(pattern))
+    if len(file_names) == 0:
+        raise ValueError("no files match {}".format(pattern))
+    for file_name in file_names:
+        with h5py.File(file_name,'r') as f:
+            if 'block_name' not in f:
+                continue
+            block_names = [row.tobytes().rstrip(b'\0').decode()
+                           for row in f['block_name'][()]]
+            for name, dataset in f.items():
+                if not name.startswith('field_'):
+                    continue
+                data = dataset[()]
+                for ib, block_name in enumerate(block_names):
+                    datasets[(block_name,name)] = data[ib]
+    return datasets
+
+def compare(test_report, ref, target):
+    """
+    Compare dicts of Block datasets, reporting each mismatch, and return
+    whether they are identical
+    """
+    success = True
+    for key in sorted(set(ref) | set(target)):
+        if key not in target or key not in ref:
+            test_report.fail("{}/{} missing in {}".format(
+                key[0], key[1], 'target' if key not in target else 'reference'))
+            success = False
+            continue
+        a = np.squeeze(ref[key])
+        b = np.squeeze(target[key])
+        if a.shape != b.shape or not np.array_equal(a,b):
+            test_report.fail("{}/{} differs".format(*key))
+            success = False
+    if success:
+        test_report.passing("{} Block datasets are identical".format(len(ref)))
+    return success
+
+parser = argparse.ArgumentParser(
+    description = _description, epilog = _epilog,
+    formatter_class = argparse.RawDescriptionHelpFormatter)
+parser.add_argument('test_file', help = 'path of the test report to write')
+parser.add_argument('mode', choices = ['blocks','shared'])
+parser.add_argument('ref', help = 'reference files (pattern)')
+parser.add_argument('target', help = 'target files (pattern)')
+
+if __name__ == '__main__':
+    args = parser.parse_args()
+    with create_test_report(args.test_file) as test_report:
+        ref = _block_datasets(args.ref)
+        if args.mode == 'blocks':
+            target = _block_datasets(args.target)
+        else:
+            target = _shared_datasets(args.target)
+            # only the fields written to the shared files are compared
+            names = set(name for _, name in target)
+            ref = dict((key, value) for key, value in ref.items()
+                       if key[1] in names)
+        compare(test_report, ref, target)